@@ -0,0 +1,139 @@
+#ifndef ASYNC_WRITER_H
+#define ASYNC_WRITER_H
+
+#include "profiler.h"
+#include <deque>
+#include <condition_variable>
+#include <cstdio>
+
+enum class WriteMode {
+    TRUNCATE,
+    APPEND,
+    REPLACE
+};
+
+class AsyncWriter {
+private:
+    static constexpr size_t MAX_QUEUED_JOBS = 64;
+    static constexpr size_t MAX_QUEUED_BYTES = 64 << 20;
+
+    struct Job {
+        std::string path;
+        std::string contents;
+        WriteMode mode;
+    };
+
+    std::mutex mutex;
+    std::condition_variable has_work;
+    std::condition_variable has_room;
+    std::condition_variable idle;
+    std::deque<Job> queue;
+    size_t queued_bytes;
+    bool writing;
+    bool stopping;
+    bool asynchronous;
+    long long failures;
+    std::thread worker;
+
+    AsyncWriter() : queued_bytes(0), writing(false), stopping(false), asynchronous(true), failures(0) {
+#ifdef WAREHOUSE_PROFILE
+        Profiler::instance();
+#endif
+    }
+
+public:
+    ~AsyncWriter() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        has_work.notify_all();
+        if (worker.joinable()) worker.join();
+    }
+
+    AsyncWriter(const AsyncWriter&) = delete;
+    AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+    static AsyncWriter& instance() {
+        static AsyncWriter writer;
+        return writer;
+    }
+
+    void setAsynchronous(bool enabled) {
+        flush();
+        asynchronous = enabled;
+    }
+
+    bool isAsynchronous() const { return asynchronous; }
+
+    long long getFailures() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return failures;
+    }
+
+    bool submit(const std::string& path, std::string contents, WriteMode mode = WriteMode::TRUNCATE) {
+        if (!asynchronous) {
+            bool ok = write(Job{path, std::move(contents), mode});
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!ok) failures++;
+            return ok;
+        }
+        PROFILE_SCOPE("AsyncWriter::submit");
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!worker.joinable()) worker = std::thread([this]() { drain(); });
+        has_room.wait(lock, [this, &contents]() {
+            return queue.empty() || (queue.size() < MAX_QUEUED_JOBS && queued_bytes + contents.size() <= MAX_QUEUED_BYTES);
+        });
+        queued_bytes += contents.size();
+        queue.push_back(Job{path, std::move(contents), mode});
+        lock.unlock();
+        has_work.notify_one();
+        return true;
+    }
+
+    void flush() {
+        PROFILE_SCOPE("AsyncWriter::flush");
+        std::unique_lock<std::mutex> lock(mutex);
+        idle.wait(lock, [this]() { return queue.empty() && !writing; });
+    }
+
+private:
+    void drain() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            has_work.wait(lock, [this]() { return stopping || !queue.empty(); });
+            if (queue.empty()) return;
+            Job job = std::move(queue.front());
+            queue.pop_front();
+            queued_bytes -= job.contents.size();
+            writing = true;
+            lock.unlock();
+            has_room.notify_all();
+
+            bool ok = write(job);
+
+            lock.lock();
+            if (!ok) failures++;
+            writing = false;
+            if (queue.empty()) idle.notify_all();
+        }
+    }
+
+    static bool write(const Job& job) {
+        PROFILE_SCOPE("AsyncWriter::write");
+        std::string target = job.mode == WriteMode::REPLACE ? job.path + ".tmp" : job.path;
+        std::ios::openmode mode = std::ios::binary | (job.mode == WriteMode::APPEND ? std::ios::app : std::ios::trunc);
+        {
+            std::ofstream file(target, mode);
+            if (!file.is_open()) {
+                std::cerr << "❌ Error: Could not open file " << target << std::endl;
+                return false;
+            }
+            file.write(job.contents.data(), job.contents.size());
+            if (!file.good()) return false;
+        }
+        return job.mode != WriteMode::REPLACE || std::rename(target.c_str(), job.path.c_str()) == 0;
+    }
+};
+
+#endif
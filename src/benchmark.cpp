@@ -0,0 +1,449 @@
+#include "warehouse_simulator.h"
+#include "inventory_store.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <memory>
+
+struct BenchmarkOptions {
+    int min_exponent;
+    int max_exponent;
+    int warmup;
+    int repetitions;
+    double budget_ms;
+    std::string filter;
+    std::string json_path;
+    std::string simd;
+};
+
+struct BenchmarkResult {
+    std::string group;
+    std::string name;
+    long long size;
+    std::string status;
+    std::vector<double> samples_ms;
+    double median_ms;
+    double p95_ms;
+    double min_ms;
+    double mean_ms;
+};
+
+class TempFile {
+private:
+    std::string path;
+
+public:
+    explicit TempFile(const std::string& name) : path((std::filesystem::temp_directory_path() / name).string()) {}
+    ~TempFile() { std::remove(path.c_str()); }
+    TempFile(const TempFile&) = delete;
+    TempFile& operator=(const TempFile&) = delete;
+
+    const std::string& getPath() const { return path; }
+};
+
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+class BenchmarkSuite {
+private:
+    using Clock = std::chrono::steady_clock;
+    using PreparedRun = std::function<void()>;
+
+    struct BenchmarkCase {
+        std::string group;
+        std::string name;
+        std::function<PreparedRun(const WarehouseDataGenerator&)> prepare;
+        double last_median_ms;
+        double growth;
+        bool exhausted;
+    };
+
+    BenchmarkOptions options;
+    std::vector<BenchmarkCase> cases;
+    std::vector<BenchmarkResult> results;
+    NullBuffer null_buffer;
+
+public:
+    explicit BenchmarkSuite(const BenchmarkOptions& opts) : options(opts) {}
+
+    void addCase(const std::string& group, const std::string& name,
+                 std::function<PreparedRun(const WarehouseDataGenerator&)> prepare) {
+        std::string label = group + "/" + name;
+        if (!options.filter.empty() && label.find(options.filter) == std::string::npos) return;
+        cases.push_back({group, name, prepare, 0, 10, false});
+    }
+
+    void run() {
+        ConsoleUI::printMenuHeader("WAREHOUSE OS SIMULATOR - MICROBENCHMARKS");
+        std::cout << "Sizes: 10^" << options.min_exponent << " .. 10^" << options.max_exponent
+                  << " | warmup " << options.warmup << " | repetitions " << options.repetitions
+                  << " | budget " << options.budget_ms << " ms per run"
+                  << " | simd " << SimdKernels::levelName(SimdKernels::getLevel()) << "\n";
+
+        long long size = 1;
+        for (int e = 0; e < options.min_exponent; ++e) size *= 10;
+
+        for (int e = options.min_exponent; e <= options.max_exponent; ++e, size *= 10) {
+            bool any_active = false;
+            for (const auto& c : cases) any_active = any_active || !c.exhausted;
+            if (!any_active) break;
+
+            std::cout << "\n" << std::string(50, '-') << "\n=> Input size " << size << "\n" << std::string(50, '-') << "\n";
+            WarehouseDataGenerator data;
+            data.setSeed(42);
+            data.generateFromConfig(configForSize(size));
+
+            for (auto& c : cases) {
+                if (c.exhausted || c.last_median_ms * c.growth > options.budget_ms) {
+                    c.exhausted = true;
+                    results.push_back({c.group, c.name, size, "skipped", {}, 0, 0, 0, 0});
+                    printResult(results.back());
+                    continue;
+                }
+                results.push_back(measure(c, data, size));
+                printResult(results.back());
+            }
+        }
+
+        writeJSON();
+    }
+
+private:
+    static GeneratorConfig configForSize(long long size) {
+        GeneratorConfig config;
+        config.num_processes = (int)size;
+        config.max_burst_time = 100;
+        config.max_priority = 10;
+        config.warehouse_size = (int)std::min<long long>(INT_MAX, size * 300);
+        config.max_block_size = 500;
+        config.max_process_size = 100;
+        config.num_disk_requests = (int)size;
+        config.max_disk_size = 100000;
+        config.head_position = 50000;
+        config.buffer_size = 64;
+        return config;
+    }
+
+    BenchmarkResult measure(BenchmarkCase& c, const WarehouseDataGenerator& data, long long size) {
+        BenchmarkResult result{c.group, c.name, size, "ok", {}, 0, 0, 0, 0};
+        std::streambuf* console = std::cout.rdbuf();
+
+        for (int rep = 0; rep < options.warmup + options.repetitions; ++rep) {
+            PreparedRun body = c.prepare(data);
+            std::cout.rdbuf(&null_buffer);
+            auto start = Clock::now();
+            body();
+            auto end = Clock::now();
+            std::cout.rdbuf(console);
+
+            double elapsed = std::chrono::duration<double, std::milli>(end - start).count();
+            if (rep >= options.warmup) result.samples_ms.push_back(elapsed);
+            if (elapsed > options.budget_ms) break;
+        }
+
+        if (result.samples_ms.empty()) {
+            result.status = "over_budget";
+            c.exhausted = true;
+            return result;
+        }
+
+        std::vector<double> sorted = result.samples_ms;
+        std::sort(sorted.begin(), sorted.end());
+        result.median_ms = sorted[sorted.size() / 2];
+        result.p95_ms = sorted[std::min(sorted.size() - 1, (size_t)std::ceil(0.95 * sorted.size()) - 1)];
+        result.min_ms = sorted.front();
+        double total = 0;
+        for (double s : sorted) total += s;
+        result.mean_ms = total / sorted.size();
+
+        if (c.last_median_ms > 0) c.growth = std::max(1.0, result.median_ms / c.last_median_ms);
+        c.last_median_ms = result.median_ms;
+        return result;
+    }
+
+    void printResult(const BenchmarkResult& r) const {
+        std::cout << std::left << std::setw(10) << r.group << std::setw(26) << r.name << std::setw(12) << r.size;
+        if (r.status != "ok") {
+            std::cout << r.status << "\n";
+            return;
+        }
+        std::cout << std::fixed << std::setprecision(3)
+                  << "median " << std::setw(12) << r.median_ms << "p95 " << std::setw(12) << r.p95_ms << "ms\n";
+    }
+
+    void writeJSON() const {
+        std::ofstream file(options.json_path);
+        if (!file.is_open()) {
+            std::cerr << "❌ Error: Could not open file " << options.json_path << std::endl;
+            return;
+        }
+
+        file << std::fixed << std::setprecision(6);
+        file << "{\n  \"warmup\": " << options.warmup << ",\n  \"repetitions\": " << options.repetitions
+             << ",\n  \"budget_ms\": " << options.budget_ms << ",\n  \"results\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const BenchmarkResult& r = results[i];
+            file << "    {\"group\": \"" << r.group << "\", \"name\": \"" << r.name << "\", \"size\": " << r.size
+                 << ", \"status\": \"" << r.status << "\"";
+            if (r.status == "ok") {
+                file << ", \"median_ms\": " << r.median_ms << ", \"p95_ms\": " << r.p95_ms
+                     << ", \"min_ms\": " << r.min_ms << ", \"mean_ms\": " << r.mean_ms << ", \"samples_ms\": [";
+                for (size_t s = 0; s < r.samples_ms.size(); ++s) {
+                    file << (s ? ", " : "") << r.samples_ms[s];
+                }
+                file << "]";
+            }
+            file << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        file << "  ]\n}\n";
+        std::cout << "\n✅ Benchmark results saved to: " << options.json_path << std::endl;
+    }
+};
+
+void registerCPUCases(BenchmarkSuite& suite) {
+    const std::vector<std::pair<std::string, CPUAlgorithm>> algorithms = {
+        {"FCFS", CPUAlgorithm::FCFS},
+        {"SJF", CPUAlgorithm::SJF},
+        {"SRJF", CPUAlgorithm::SRJF},
+        {"PRIORITY_NON_PREEMPTIVE", CPUAlgorithm::PRIORITY_NON_PREEMPTIVE},
+        {"PRIORITY_PREEMPTIVE", CPUAlgorithm::PRIORITY_PREEMPTIVE},
+        {"RR_TQ4", CPUAlgorithm::ROUND_ROBIN}
+    };
+    for (const auto& entry : algorithms) {
+        CPUAlgorithm algorithm = entry.second;
+        suite.addCase("cpu", entry.first, [algorithm](const WarehouseDataGenerator& data) {
+            auto scheduler = std::make_shared<CPUScheduler>(data.getDataset().processes);
+            return [scheduler, algorithm]() { scheduler->schedule(algorithm, 4); };
+        });
+    }
+
+    suite.addCase("cpu", "MLFQ", [](const WarehouseDataGenerator& data) {
+        auto scheduler = std::make_shared<CPUScheduler>(data.getDataset().processes);
+        return [scheduler]() { scheduler->scheduleMLFQ({{2, 4, 8}, 100}); };
+    });
+    suite.addCase("cpu", "CFS", [](const WarehouseDataGenerator& data) {
+        auto scheduler = std::make_shared<CPUScheduler>(data.getDataset().processes);
+        return [scheduler]() { scheduler->scheduleCFS({20, 2}); };
+    });
+
+    for (QueueMode mode : {QueueMode::GLOBAL, QueueMode::PER_WORKER}) {
+        std::string name = mode == QueueMode::GLOBAL ? "MULTI_SRJF_16W_GLOBAL" : "MULTI_SRJF_16W_BALANCED";
+        suite.addCase("cpu", name, [mode](const WarehouseDataGenerator& data) {
+            MultiWorkerConfig config{CPUAlgorithm::SRJF, 16, mode, mode == QueueMode::PER_WORKER, 4};
+            auto simulator = std::make_shared<MultiWorkerSimulator>(data.getProcesses(), config);
+            return [simulator]() { simulator->run(); };
+        });
+    }
+}
+
+void registerMemoryCases(BenchmarkSuite& suite) {
+    const std::vector<std::pair<std::string, FitStrategy>> strategies = {
+        {"FIRST_FIT", FitStrategy::FIRST_FIT},
+        {"BEST_FIT", FitStrategy::BEST_FIT},
+        {"NEXT_FIT", FitStrategy::NEXT_FIT},
+        {"WORST_FIT", FitStrategy::WORST_FIT}
+    };
+    for (const auto& entry : strategies) {
+        FitStrategy strategy = entry.second;
+        suite.addCase("memory", entry.first, [strategy](const WarehouseDataGenerator& data) {
+            auto manager = std::make_shared<MemoryManager>(data.getMemoryBlocks(), data.getDataset().processes,
+                                                           data.getWarehouseSize(), data.getMaxProcessSize());
+            return [manager, strategy]() { manager->allocate(strategy); };
+        });
+    }
+    for (int budget : {-1, 16}) {
+        std::string name = budget < 0 ? "COMPACTION_FULL" : "COMPACTION_K" + std::to_string(budget);
+        suite.addCase("memory", name, [budget](const WarehouseDataGenerator& data) {
+            std::vector<MemoryBlock> racks = data.getMemoryBlocks();
+            const auto& orders = data.getProcesses();
+            for (size_t i = 0; i < racks.size() && i < orders.size(); ++i) {
+                if (racks[i].size < orders[i].size) continue;
+                racks[i].is_allocated = true;
+                racks[i].process_id = orders[i].id;
+            }
+            auto manager = std::make_shared<MemoryManager>(racks, data.getDataset().processes, data.getWarehouseSize(),
+                                                           data.getMaxProcessSize());
+            manager->releaseShipped(40, data.getSeed());
+            return [manager, budget]() { manager->planCompaction(budget); };
+        });
+    }
+}
+
+void registerBinCacheCases(BenchmarkSuite& suite) {
+    for (ReplacementPolicy policy : {ReplacementPolicy::FIFO, ReplacementPolicy::LRU, ReplacementPolicy::CLOCK,
+                                     ReplacementPolicy::LFU, ReplacementPolicy::OPT}) {
+        suite.addCase("bincache", BinCacheSimulator::policyName(policy), [policy](const WarehouseDataGenerator& data) {
+            long long accesses = data.getProcesses().size();
+            int bins = std::max(16, (int)(accesses / 10));
+            auto trace = std::make_shared<std::vector<int>>(
+                BinAccessTrace::fromOrders(data.getProcesses(), bins, accesses, data.getSeed()));
+            return [trace, policy, bins]() { BinCacheSimulator(*trace).simulate(policy, bins / 20); };
+        });
+    }
+}
+
+void registerDiskCases(BenchmarkSuite& suite) {
+    const std::vector<std::pair<std::string, DiskAlgorithm>> algorithms = {
+        {"FCFS", DiskAlgorithm::FCFS},
+        {"SSTF", DiskAlgorithm::SSTF},
+        {"SCAN", DiskAlgorithm::SCAN},
+        {"CSCAN", DiskAlgorithm::CSCAN}
+    };
+    for (const auto& entry : algorithms) {
+        DiskAlgorithm algorithm = entry.second;
+        suite.addCase("disk", entry.first, [algorithm](const WarehouseDataGenerator& data) {
+            auto scheduler = std::make_shared<DiskScheduler>(data.getDataset().disk_requests, data.getHeadPosition(),
+                                                             data.getMaxDiskSize());
+            return [scheduler, algorithm]() { scheduler->schedule(algorithm, true); };
+        });
+    }
+}
+
+template <typename MakeBuffer>
+void addStockThroughputCase(BenchmarkSuite& suite, const std::string& name, int pairs, MakeBuffer make_buffer) {
+    suite.addCase("sync", name, [pairs, make_buffer](const WarehouseDataGenerator& data) {
+        int items = data.getProcesses().size();
+        int capacity = data.getBufferSize();
+        return [items, capacity, pairs, make_buffer]() {
+            auto buffer = make_buffer(capacity, pairs);
+            std::vector<std::thread> threads;
+            for (int t = 0; t < pairs; ++t) {
+                int count = items / pairs + (t < items % pairs ? 1 : 0);
+                threads.push_back(std::thread([&buffer, t, count]() {
+                    for (int i = 0; i < count; ++i) buffer->produce(t + 1, i);
+                }));
+                threads.push_back(std::thread([&buffer, t, count]() {
+                    for (int i = 0; i < count; ++i) buffer->consume(t + 1);
+                }));
+            }
+            for (auto& thread : threads) thread.join();
+        };
+    });
+}
+
+void registerSyncCases(BenchmarkSuite& suite) {
+    auto global = [](int capacity, int pairs) { return std::make_unique<StockBuffer>(capacity, pairs, pairs); };
+    for (int pairs : {2, 8, 64}) {
+        std::string threads = std::to_string(pairs) + "P_" + std::to_string(pairs) + "C";
+        addStockThroughputCase(suite, "STOCK_BUFFER_" + threads, pairs, global);
+        for (int shards : {pairs / 2, pairs}) {
+            if (shards < 2) continue;
+            addStockThroughputCase(suite, "STOCK_SHARDED_" + std::to_string(shards) + "S_" + threads, pairs,
+                                   [shards](int capacity, int) {
+                                       return std::make_unique<ShardedStockBuffer>(std::max(1, capacity / shards), shards);
+                                   });
+        }
+    }
+    suite.addCase("sync", "STOCK_BUFFER_CORO_2N", [](const WarehouseDataGenerator& data) {
+        int actors = std::max(1, (int)data.getProcesses().size());
+        int capacity = data.getBufferSize();
+        int threads = (int)std::max(1u, std::thread::hardware_concurrency());
+        return [actors, capacity, threads]() {
+            Synchronization sync(capacity, actors, actors);
+            sync.runCoroutineProducerConsumer(1, threads);
+        };
+    });
+}
+
+void addInventoryReadCase(BenchmarkSuite& suite, int readers, int writers) {
+    std::string name = "TOTALS_" + std::to_string(readers) + "R_" + std::to_string(writers) + "W";
+    suite.addCase("inventory", name, [readers, writers](const WarehouseDataGenerator& data) {
+        int reads = data.getProcesses().size();
+        auto store = std::make_shared<InventoryStore>(4096);
+        for (int sku = 0; sku < store->getSkuCount(); ++sku) store->restock(sku, 1000);
+        return [store, reads, readers, writers]() {
+            std::atomic<bool> done(false);
+            std::atomic<long long> observed(0);
+            std::vector<std::thread> threads;
+            for (int w = 0; w < writers; ++w) {
+                threads.push_back(std::thread([&store, &done, w]() {
+                    int skus = store->getSkuCount();
+                    for (unsigned i = w; !done.load(std::memory_order_relaxed); i += 7919) {
+                        int sku = i % skus;
+                        if (!store->pick(sku, 1)) store->restock(sku, 1000);
+                        store->pickOrder({{sku, 1}, {(sku + 1) % skus, 1}, {(sku + 17) % skus, 1}});
+                    }
+                }));
+            }
+            std::vector<std::thread> reader_threads;
+            for (int r = 0; r < readers; ++r) {
+                int count = reads / readers + (r < reads % readers ? 1 : 0);
+                reader_threads.push_back(std::thread([&store, &observed, r, count]() {
+                    long long sum = 0;
+                    for (int i = 0; i < count; ++i) sum += store->getTotalUnits() + store->getStock((r + i) % 4096);
+                    observed += sum;
+                }));
+            }
+            for (auto& thread : reader_threads) thread.join();
+            done = true;
+            for (auto& thread : threads) thread.join();
+        };
+    });
+}
+
+void registerInventoryCases(BenchmarkSuite& suite) {
+    for (int writers : {0, 1, 4}) addInventoryReadCase(suite, 4, writers);
+}
+
+void registerImportCases(BenchmarkSuite& suite) {
+    suite.addCase("import", "ORDER_TRACE_CSV", [](const WarehouseDataGenerator& data) {
+        auto trace = std::make_shared<TempFile>("warehouse_bench_orders.csv");
+        std::ofstream file(trace->getPath(), std::ios::binary);
+        file << "order_id,created_at,sku,pick_time,priority,volume\n";
+        for (const auto& p : data.getProcesses()) {
+            file << p.id << "," << 1700000000LL + p.arrival_time << ",SKU" << p.id % 9973 << "," << p.burst_time << ".5,"
+                 << p.priority << "," << p.burst_time * 3 << "\n";
+        }
+        file.close();
+        return [trace]() {
+            TraceImporter importer;
+            std::vector<Process> orders;
+            int largest = 0;
+            importer.importOrders(trace->getPath(), orders, largest);
+        };
+    });
+}
+
+int main(int argc, char* argv[]) {
+    BenchmarkOptions options{2, 7, 1, 5, 2000.0, "", "output/benchmark_results.json", ""};
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string flag = argv[i];
+        std::string value = argv[i + 1];
+        if (flag == "--min-exp") options.min_exponent = std::stoi(value);
+        else if (flag == "--max-exp") options.max_exponent = std::stoi(value);
+        else if (flag == "--warmup") options.warmup = std::stoi(value);
+        else if (flag == "--reps") options.repetitions = std::max(1, std::stoi(value));
+        else if (flag == "--budget-ms") options.budget_ms = std::stod(value);
+        else if (flag == "--filter") options.filter = value;
+        else if (flag == "--json") options.json_path = value;
+        else if (flag == "--simd") options.simd = value;
+        else {
+            std::cerr << "Unknown option " << flag << "\n"
+                      << "Usage: warehouse_bench [--min-exp N] [--max-exp N] [--warmup N] [--reps N]"
+                      << " [--budget-ms MS] [--filter TEXT] [--json FILE] [--simd scalar|sse4.2|avx2]\n";
+            return 1;
+        }
+    }
+
+    for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::SSE4, SimdLevel::AVX2}) {
+        if (options.simd == SimdKernels::levelName(level)) SimdKernels::setLevel(level);
+    }
+
+    FileManager::createDirectoryIfNeeded("output");
+    ConsoleUI::setVerbosity(Verbosity::OFF);
+    BenchmarkSuite suite(options);
+    registerCPUCases(suite);
+    registerMemoryCases(suite);
+    registerBinCacheCases(suite);
+    registerDiskCases(suite);
+    registerSyncCases(suite);
+    registerInventoryCases(suite);
+    registerImportCases(suite);
+    suite.run();
+    return 0;
+}
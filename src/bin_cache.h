@@ -0,0 +1,321 @@
+#ifndef BIN_CACHE_H
+#define BIN_CACHE_H
+
+#include "utilities.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+enum class ReplacementPolicy {
+    FIFO,
+    LRU,
+    CLOCK,
+    LFU,
+    OPT
+};
+
+struct BinCacheResult {
+    ReplacementPolicy policy;
+    int capacity;
+    long long accesses;
+    long long hits;
+    long long evictions;
+    double seconds;
+
+    double hitRatio() const { return accesses > 0 ? (double)hits / accesses : 0.0; }
+    double accessesPerSecond() const { return seconds > 0 ? accesses / seconds : 0.0; }
+};
+
+class BinAccessTrace {
+public:
+    static std::vector<int> fromOrders(const std::vector<Process>& orders, int bins, long long accesses, unsigned seed) {
+        PROFILE_SCOPE("BinAccessTrace::fromOrders");
+        std::vector<int> trace;
+        if (orders.empty() || bins <= 0 || accesses <= 0) return trace;
+        trace.reserve(accesses);
+        std::mt19937_64 gen(seed + 3);
+        while ((long long)trace.size() < accesses) {
+            for (const auto& order : orders) {
+                double u = (gen() >> 11) * 0x1.0p-53;
+                int base = (int)(bins * u * u * u);
+                int lines = 1 + order.burst_time % 4;
+                for (int k = 0; k < lines && (long long)trace.size() < accesses; ++k) trace.push_back((base + k) % bins);
+                if ((long long)trace.size() == accesses) break;
+            }
+        }
+        return trace;
+    }
+};
+
+class BinCacheSimulator {
+private:
+    const std::vector<int>& trace;
+    int num_bins;
+
+public:
+    explicit BinCacheSimulator(const std::vector<int>& accesses) : trace(accesses), num_bins(0) {
+        for (int bin : trace) num_bins = std::max(num_bins, bin + 1);
+    }
+
+    static std::string policyName(ReplacementPolicy policy) {
+        switch (policy) {
+            case ReplacementPolicy::FIFO: return "FIFO";
+            case ReplacementPolicy::LRU: return "LRU";
+            case ReplacementPolicy::CLOCK: return "CLOCK";
+            case ReplacementPolicy::LFU: return "LFU";
+            case ReplacementPolicy::OPT: return "OPT";
+        }
+        return "";
+    }
+
+    int getBinCount() const { return num_bins; }
+
+    BinCacheResult simulate(ReplacementPolicy policy, int capacity) const {
+        PROFILE_SCOPE("BinCacheSimulator::simulate");
+        BinCacheResult result{policy, std::max(1, capacity), (long long)trace.size(), 0, 0, 0.0};
+        auto start = std::chrono::steady_clock::now();
+        switch (policy) {
+            case ReplacementPolicy::FIFO: runFIFO(result); break;
+            case ReplacementPolicy::LRU: runLRU(result); break;
+            case ReplacementPolicy::CLOCK: runCLOCK(result); break;
+            case ReplacementPolicy::LFU: runLFU(result); break;
+            case ReplacementPolicy::OPT: runOPT(result); break;
+        }
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return result;
+    }
+
+    void runSweep(const std::vector<int>& capacities) const {
+        ConsoleUI::printSection("Forward-Pick Bin Cache - Hit Ratio vs Cache Size");
+        const ReplacementPolicy policies[] = {ReplacementPolicy::FIFO, ReplacementPolicy::LRU, ReplacementPolicy::CLOCK,
+                                              ReplacementPolicy::LFU, ReplacementPolicy::OPT};
+        std::vector<std::vector<std::string>> csv = {{"Cache_Bins", "Policy", "Accesses", "Hits", "Evictions",
+                                                      "Hit_Ratio", "Accesses_Per_Second"}};
+        std::vector<double> seconds(5, 0.0);
+
+        std::ostringstream table;
+        table << std::left << std::setw(12) << "Cache_Bins";
+        for (ReplacementPolicy policy : policies) table << std::setw(10) << policyName(policy);
+        table << "\n" << std::string(62, '-') << "\n";
+        for (int capacity : capacities) {
+            table << std::setw(12) << capacity;
+            for (int p = 0; p < 5; ++p) {
+                BinCacheResult result = simulate(policies[p], capacity);
+                seconds[p] += result.seconds;
+                std::ostringstream cell;
+                cell << std::fixed << std::setprecision(2) << result.hitRatio() * 100 << "%";
+                table << std::setw(10) << cell.str();
+                csv.push_back({std::to_string(capacity), policyName(policies[p]), std::to_string(result.accesses),
+                               std::to_string(result.hits), std::to_string(result.evictions),
+                               std::to_string(result.hitRatio()), std::to_string((long long)result.accessesPerSecond())});
+            }
+            table << "\n";
+        }
+        if (ConsoleUI::showSummary()) {
+            std::cout << table.str();
+            std::cout << std::string(62, '-') << "\n";
+            std::cout << "Accesses: " << trace.size() << " over " << num_bins << " bins\n";
+            for (int p = 0; p < 5; ++p) {
+                double rate = seconds[p] > 0 ? trace.size() * capacities.size() / seconds[p] : 0.0;
+                std::cout << std::left << std::setw(7) << policyName(policies[p]) << std::fixed << std::setprecision(1)
+                          << rate / 1e6 << " M accesses/s\n";
+            }
+        }
+        FileManager::writeToCSV("output/bin_cache_hit_ratios.csv", csv);
+    }
+
+private:
+    void runFIFO(BinCacheResult& result) const {
+        std::vector<char> resident(num_bins, 0);
+        std::vector<int> frames(result.capacity, -1);
+        int next = 0;
+        for (int bin : trace) {
+            if (resident[bin]) {
+                result.hits++;
+                continue;
+            }
+            if (frames[next] >= 0) {
+                resident[frames[next]] = 0;
+                result.evictions++;
+            }
+            frames[next] = bin;
+            resident[bin] = 1;
+            if (++next == result.capacity) next = 0;
+        }
+    }
+
+    void runLRU(BinCacheResult& result) const {
+        std::vector<int> prev(num_bins, -1), next(num_bins, -1);
+        std::vector<char> resident(num_bins, 0);
+        int head = -1, tail = -1, size = 0;
+        auto unlink = [&](int bin) {
+            if (prev[bin] >= 0) next[prev[bin]] = next[bin];
+            else head = next[bin];
+            if (next[bin] >= 0) prev[next[bin]] = prev[bin];
+            else tail = prev[bin];
+        };
+        auto pushFront = [&](int bin) {
+            prev[bin] = -1;
+            next[bin] = head;
+            if (head >= 0) prev[head] = bin;
+            head = bin;
+            if (tail < 0) tail = bin;
+        };
+        for (int bin : trace) {
+            if (resident[bin]) {
+                result.hits++;
+                if (head != bin) {
+                    unlink(bin);
+                    pushFront(bin);
+                }
+                continue;
+            }
+            if (size == result.capacity) {
+                int victim = tail;
+                unlink(victim);
+                resident[victim] = 0;
+                result.evictions++;
+            } else {
+                size++;
+            }
+            pushFront(bin);
+            resident[bin] = 1;
+        }
+    }
+
+    void runCLOCK(BinCacheResult& result) const {
+        std::vector<int> frame_of(num_bins, -1);
+        std::vector<int> frames(result.capacity, -1);
+        std::vector<char> referenced(result.capacity, 0);
+        int hand = 0;
+        for (int bin : trace) {
+            int frame = frame_of[bin];
+            if (frame >= 0) {
+                result.hits++;
+                referenced[frame] = 1;
+                continue;
+            }
+            while (referenced[hand]) {
+                referenced[hand] = 0;
+                if (++hand == result.capacity) hand = 0;
+            }
+            if (frames[hand] >= 0) {
+                frame_of[frames[hand]] = -1;
+                result.evictions++;
+            }
+            frames[hand] = bin;
+            frame_of[bin] = hand;
+            referenced[hand] = 1;
+            if (++hand == result.capacity) hand = 0;
+        }
+    }
+
+    void runLFU(BinCacheResult& result) const {
+        std::vector<int> prev(num_bins, -1), next(num_bins, -1), count(num_bins, 0);
+        std::vector<int> bucket_head(2, -1), bucket_tail(2, -1);
+        int min_count = 0, size = 0;
+        auto unlink = [&](int bin) {
+            int c = count[bin];
+            if (prev[bin] >= 0) next[prev[bin]] = next[bin];
+            else bucket_head[c] = next[bin];
+            if (next[bin] >= 0) prev[next[bin]] = prev[bin];
+            else bucket_tail[c] = prev[bin];
+        };
+        auto pushFront = [&](int bin) {
+            int c = count[bin];
+            if (c >= (int)bucket_head.size()) {
+                bucket_head.resize(c + 1, -1);
+                bucket_tail.resize(c + 1, -1);
+            }
+            prev[bin] = -1;
+            next[bin] = bucket_head[c];
+            if (bucket_head[c] >= 0) prev[bucket_head[c]] = bin;
+            bucket_head[c] = bin;
+            if (bucket_tail[c] < 0) bucket_tail[c] = bin;
+        };
+        for (int bin : trace) {
+            if (count[bin] > 0) {
+                result.hits++;
+                unlink(bin);
+                if (count[bin] == min_count && bucket_head[min_count] < 0) min_count++;
+                count[bin]++;
+                pushFront(bin);
+                continue;
+            }
+            if (size == result.capacity) {
+                int victim = bucket_tail[min_count];
+                unlink(victim);
+                count[victim] = 0;
+                result.evictions++;
+            } else {
+                size++;
+            }
+            count[bin] = 1;
+            pushFront(bin);
+            min_count = 1;
+        }
+    }
+
+    void runOPT(BinCacheResult& result) const {
+        const int n = (int)trace.size();
+        std::vector<int> next_use(n);
+        std::vector<int> upcoming(num_bins, n);
+        for (int i = n - 1; i >= 0; --i) {
+            next_use[i] = upcoming[trace[i]];
+            upcoming[trace[i]] = i;
+        }
+
+        std::vector<int> slot_of(num_bins, -1);
+        std::vector<uint64_t> heap;
+        heap.reserve(result.capacity);
+        auto entry = [](int key, int bin) { return ((uint64_t)key << 32) | (uint32_t)bin; };
+        auto place = [&](int slot, uint64_t value) {
+            heap[slot] = value;
+            slot_of[(uint32_t)value] = slot;
+        };
+        auto siftUp = [&](int slot, uint64_t value) {
+            while (slot > 0) {
+                int parent = (slot - 1) / 4;
+                if (heap[parent] >= value) break;
+                place(slot, heap[parent]);
+                slot = parent;
+            }
+            place(slot, value);
+        };
+        auto siftDown = [&](int slot, uint64_t value) {
+            int size = (int)heap.size();
+            while (true) {
+                int first = 4 * slot + 1;
+                if (first >= size) break;
+                int best = first;
+                int last = std::min(first + 4, size);
+                for (int child = first + 1; child < last; ++child) {
+                    if (heap[child] > heap[best]) best = child;
+                }
+                if (heap[best] <= value) break;
+                place(slot, heap[best]);
+                slot = best;
+            }
+            place(slot, value);
+        };
+
+        for (int i = 0; i < n; ++i) {
+            int bin = trace[i];
+            int slot = slot_of[bin];
+            if (slot >= 0) {
+                result.hits++;
+                siftUp(slot, entry(next_use[i], bin));
+            } else if ((int)heap.size() == result.capacity) {
+                slot_of[(uint32_t)heap[0]] = -1;
+                result.evictions++;
+                siftDown(0, entry(next_use[i], bin));
+            } else {
+                heap.push_back(0);
+                siftUp((int)heap.size() - 1, entry(next_use[i], bin));
+            }
+        }
+    }
+};
+
+#endif
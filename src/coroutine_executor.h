@@ -0,0 +1,131 @@
+#ifndef COROUTINE_EXECUTOR_H
+#define COROUTINE_EXECUTOR_H
+
+#include <coroutine>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+#include <exception>
+
+class CoroutineExecutor;
+
+class Task {
+public:
+    struct promise_type {
+        CoroutineExecutor* executor = nullptr;
+
+        Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        struct FinalAwaiter {
+            bool await_ready() noexcept { return false; }
+            void await_suspend(std::coroutine_handle<promise_type> handle) noexcept;
+            void await_resume() noexcept {}
+        };
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    Task(Task&& other) noexcept : handle(other.handle) { other.handle = nullptr; }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    ~Task() {
+        if (handle) handle.destroy();
+    }
+
+private:
+    friend class CoroutineExecutor;
+    explicit Task(std::coroutine_handle<promise_type> h) : handle(h) {}
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+class CoroutineExecutor {
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<std::coroutine_handle<>> ready;
+    long long live_tasks;
+    int idle_workers;
+    int num_workers;
+    bool stalled;
+    long long resumes;
+
+public:
+    explicit CoroutineExecutor(int workers)
+        : live_tasks(0), idle_workers(0), num_workers(std::max(1, workers)), stalled(false), resumes(0) {}
+
+    void spawn(Task task) {
+        std::coroutine_handle<Task::promise_type> handle = task.handle;
+        task.handle = nullptr;
+        handle.promise().executor = this;
+        std::lock_guard<std::mutex> lock(mtx);
+        live_tasks++;
+        ready.push_back(handle);
+    }
+
+    void schedule(std::coroutine_handle<> handle) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            ready.push_back(handle);
+        }
+        cv.notify_one();
+    }
+
+    bool run() {
+        std::vector<std::thread> workers;
+        for (int t = 1; t < num_workers; ++t) workers.push_back(std::thread([this]() { work(); }));
+        work();
+        for (auto& worker : workers) worker.join();
+        return !stalled;
+    }
+
+    int getWorkerCount() const { return num_workers; }
+    long long getResumes() const { return resumes; }
+    long long getLiveTasks() const { return live_tasks; }
+
+private:
+    friend struct Task::promise_type::FinalAwaiter;
+
+    void finished() {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (--live_tasks == 0) cv.notify_all();
+    }
+
+    void work() {
+        long long local_resumes = 0;
+        std::unique_lock<std::mutex> lock(mtx);
+        while (true) {
+            if (ready.empty()) {
+                if (live_tasks == 0 || stalled) break;
+                if (++idle_workers == num_workers) {
+                    stalled = true;
+                    cv.notify_all();
+                    break;
+                }
+                cv.wait(lock, [this]() { return !ready.empty() || live_tasks == 0 || stalled; });
+                idle_workers--;
+                continue;
+            }
+            std::coroutine_handle<> handle = ready.front();
+            ready.pop_front();
+            lock.unlock();
+            handle.resume();
+            local_resumes++;
+            lock.lock();
+        }
+        resumes += local_resumes;
+    }
+};
+
+inline void Task::promise_type::FinalAwaiter::await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+    CoroutineExecutor* executor = handle.promise().executor;
+    handle.destroy();
+    if (executor) executor->finished();
+}
+
+#endif
@@ -2,315 +2,525 @@
 #define CPU_SCHEDULER_H
 
 #include "utilities.h"
+#include "multi_worker_scheduler.h"
+#include "execution_timeline.h"
+#include "scratch_arena.h"
+#include "scheduling_policies.h"
+#include "latency_histogram.h"
+#include "simd_kernels.h"
+#include "result_cache.h"
+#include <cstddef>
 #include <queue>
 #include <numeric>
 #include <set>
+#include <map>
+#include <deque>
+#include <memory>
+
+struct MLFQConfig {
+    std::vector<int> quanta;
+    int boost_period;
+};
+
+struct CFSConfig {
+    int target_latency;
+    int min_granularity;
+};
 
 class CPUScheduler {
 private:
-    std::vector<Process> processes;
+    std::shared_ptr<const std::vector<Process>> shared_processes;
+    const std::vector<Process>& processes;
     std::vector<Process> completed;
     double cpu_utilization;
     int total_time;
+    int context_switch_cost;
+    int context_switches;
+    ExecutionTimeline timeline;
+    LatencyHistogram response_histogram;
+    ResultCache* result_cache;
+    uint64_t dataset_hash;
 
 public:
-    CPUScheduler(const std::vector<Process>& procs) : processes(procs), cpu_utilization(0), total_time(0) {}
+    explicit CPUScheduler(std::shared_ptr<const std::vector<Process>> procs)
+        : shared_processes(std::move(procs)), processes(*shared_processes), cpu_utilization(0), total_time(0),
+          context_switch_cost(0), context_switches(0), result_cache(nullptr), dataset_hash(0) {}
+
+    explicit CPUScheduler(const std::vector<Process>& procs)
+        : CPUScheduler(std::make_shared<const std::vector<Process>>(procs)) {}
+
+    void setContextSwitchCost(int cost) { context_switch_cost = std::max(0, cost); }
+
+    void setResultCache(ResultCache* cache, uint64_t hash) {
+        result_cache = cache;
+        dataset_hash = hash;
+    }
 
     void runFCFS() {
         ConsoleUI::printSection("FCFS Scheduling - Orders Handled by Arrival Sequence");
-        completed.clear();
-        completed = processes;
-        std::sort(completed.begin(), completed.end(),
-                 [](const Process& a, const Process& b) { return a.arrival_time < b.arrival_time; });
-
-        int current_time = 0;
-        for (auto& p : completed) {
-            if (current_time < p.arrival_time) current_time = p.arrival_time;
-            p.completion_time = current_time + p.burst_time;
-            p.waiting_time = current_time - p.arrival_time;
-            p.turnaround_time = p.completion_time - p.arrival_time;
-            current_time = p.completion_time;
-        }
-        total_time = current_time;
+        scheduleCached(runKey("FCFS"), [this] { scheduleFCFS(); });
         displayResults("FCFS");
         saveToCSV("output/fcfs_cpu_results.csv");
     }
 
+    void scheduleFCFS() {
+        PROFILE_SCOPE("CPUScheduler::scheduleFCFS");
+        runPolicy<ArrivalOrderPolicy>();
+    }
+
     void runSJF() {
         ConsoleUI::printSection("SJF Scheduling - Smallest Orders Processed First");
-        completed.clear();
-        completed = processes;
-
-        int current_time = 0;
-        for (size_t i = 0; i < completed.size(); ++i) {
-            auto remaining = completed.begin() + i;
-            for (auto it = remaining; it != completed.end(); ++it) {
-                if (it->arrival_time <= current_time &&
-                    it->burst_time < remaining->burst_time) {
-                    std::swap(*remaining, *it);
-                }
-            }
-            if (current_time < completed[i].arrival_time) {
-                current_time = completed[i].arrival_time;
-            }
-            completed[i].completion_time = current_time + completed[i].burst_time;
-            completed[i].waiting_time = current_time - completed[i].arrival_time;
-            completed[i].turnaround_time = completed[i].completion_time - completed[i].arrival_time;
-            current_time = completed[i].completion_time;
-        }
-        total_time = current_time;
+        scheduleCached(runKey("SJF"), [this] { scheduleSJF(); });
         displayResults("SJF");
         saveToCSV("output/sjf_cpu_results.csv");
     }
 
+    void scheduleSJF() {
+        PROFILE_SCOPE("CPUScheduler::scheduleSJF");
+        runPolicy<ShortestBurstPolicy>();
+    }
+
     void runSRJF() {
         ConsoleUI::printSection("SRJF Scheduling - Preemptive Shortest Job First");
-        completed = processes;
-        std::sort(completed.begin(), completed.end(),
-                 [](const Process& a, const Process& b) { return a.arrival_time < b.arrival_time; });
+        scheduleCached(runKey("SRJF"), [this] { scheduleSRJF(); });
+        displayResults("SRJF");
+        saveToCSV("output/srjf_cpu_results.csv");
+    }
 
-        std::vector<int> remaining_time(completed.size());
-        for (size_t i = 0; i < completed.size(); ++i) {
-            remaining_time[i] = completed[i].burst_time;
+    void scheduleSRJF() {
+        PROFILE_SCOPE("CPUScheduler::scheduleSRJF");
+        runPolicy<ShortestRemainingPolicy>();
+    }
+
+    void runPriorityScheduling(bool preemptive) {
+        std::string mode = preemptive ? "PREEMPTIVE" : "NON-PREEMPTIVE";
+        ConsoleUI::printSection("Priority Scheduling - " + mode + " (Higher Number = Higher Priority)");
+        scheduleCached(runKey("PRIORITY_" + mode), [this, preemptive] { schedulePriority(preemptive); });
+        displayResults("PRIORITY_" + mode);
+        saveToCSV("output/priority_" + (preemptive ? std::string("preemptive") : std::string("non_preemptive")) + "_cpu_results.csv");
+    }
+
+    void schedulePriority(bool preemptive) {
+        PROFILE_SCOPE(preemptive ? "CPUScheduler::schedulePreemptivePriority" : "CPUScheduler::scheduleNonPreemptivePriority");
+        if (preemptive) {
+            runPolicy<HighestPriorityPolicy<true>>();
+        } else {
+            runPolicy<HighestPriorityPolicy<false>>();
         }
+    }
 
-        int current_time = 0;
-        int processed = 0;
+    void schedule(CPUAlgorithm algorithm, int time_quantum = 1) {
+        switch (algorithm) {
+            case CPUAlgorithm::FCFS: scheduleFCFS(); break;
+            case CPUAlgorithm::SJF: scheduleSJF(); break;
+            case CPUAlgorithm::SRJF: scheduleSRJF(); break;
+            case CPUAlgorithm::PRIORITY_NON_PREEMPTIVE: schedulePriority(false); break;
+            case CPUAlgorithm::PRIORITY_PREEMPTIVE: schedulePriority(true); break;
+            case CPUAlgorithm::ROUND_ROBIN: scheduleRoundRobin(time_quantum); break;
+        }
+    }
 
-        while (processed < (int)completed.size()) {
-            int next_process = -1;
-            int min_remaining = INT_MAX;
+    void scheduleRoundRobin(int time_quantum) {
+        PROFILE_SCOPE("CPUScheduler::scheduleRoundRobin");
+        runPolicy<RoundRobinPolicy>(time_quantum);
+    }
 
-            for (size_t i = 0; i < completed.size(); ++i) {
-                if (completed[i].arrival_time <= current_time && remaining_time[i] > 0 &&
-                    remaining_time[i] < min_remaining) {
-                    next_process = i;
-                    min_remaining = remaining_time[i];
-                }
-            }
+private:
+    CacheKey runKey(const std::string& algorithm) const {
+        return CacheKey().add((long long)dataset_hash).add("cpu").add(algorithm).add(context_switch_cost);
+    }
 
-            if (next_process == -1) {
-                int next_arrival = INT_MAX;
-                for (size_t i = 0; i < completed.size(); ++i) {
-                    if (remaining_time[i] > 0 && completed[i].arrival_time < next_arrival) {
-                        next_arrival = completed[i].arrival_time;
-                    }
-                }
-                if (next_arrival != INT_MAX) {
-                    current_time = next_arrival;
-                }
-                continue;
-            }
+    template <typename Schedule>
+    void scheduleCached(const CacheKey& key, Schedule&& schedule) {
+        CacheRecord record;
+        if (result_cache && result_cache->load(key, record) && restoreRun(record)) return;
+        schedule();
+        if (!result_cache) return;
+        CacheRecord saved;
+        saved.put(total_time);
+        saved.put(context_switches);
+        saved.putVector(completed);
+        saved.putVector(timeline.getSlices());
+        response_histogram.save(saved);
+        result_cache->store(key, saved);
+    }
 
-            remaining_time[next_process]--;
-            current_time++;
+    bool restoreRun(CacheRecord& record) {
+        std::vector<TimelineSlice> slices;
+        if (!record.get(total_time) || !record.get(context_switches) || !record.getVector(completed) ||
+            !record.getVector(slices) || !response_histogram.load(record) || !record.good()) {
+            return false;
+        }
+        timeline.reset(slices.size());
+        for (const auto& slice : slices) timeline.record(slice.order_id, slice.start, slice.end);
+        return true;
+    }
 
-            if (remaining_time[next_process] == 0) {
-                completed[next_process].completion_time = current_time;
-                completed[next_process].waiting_time = current_time - completed[next_process].burst_time - completed[next_process].arrival_time;
-                completed[next_process].turnaround_time = current_time - completed[next_process].arrival_time;
-                processed++;
-            }
+    void chargeSwitch(int& current_time, int& last_process, int next_process) {
+        if (last_process != -1 && last_process != next_process) {
+            context_switches++;
+            current_time += context_switch_cost;
         }
+        last_process = next_process;
+    }
 
-        total_time = current_time;
-        displayResults("SRJF");
-        saveToCSV("output/srjf_cpu_results.csv");
+    template <typename Policy>
+    void runPolicy(int time_quantum = 1) {
+        ScratchArena::Scope scratch;
+        beginRun();
+        total_time = PolicySchedulerCore<Policy>::run(completed, std::max(1, time_quantum), context_switch_cost,
+                                                      context_switches, timeline, response_histogram);
     }
 
-    void runPriorityScheduling(bool preemptive) {
-        std::string mode = preemptive ? "PREEMPTIVE" : "NON-PREEMPTIVE";
-        ConsoleUI::printSection("Priority Scheduling - " + mode + " (Higher Number = Higher Priority)");
-        completed = processes;
+    void beginRun() {
+        loadByArrival();
+        timeline.reset(completed.size());
+        response_histogram.reset();
+    }
 
-        if (!preemptive) {
-            runNonPreemptivePriority();
-        } else {
-            runPreemptivePriority();
-        }
+    void recordFirstStart(ScratchVector<bool>& started, int index, int current_time) {
+        if (started[index]) return;
+        started[index] = true;
+        response_histogram.record(current_time - completed[index].arrival_time);
+    }
 
-        total_time = completed.back().completion_time;
-        displayResults("PRIORITY_" + mode);
-        saveToCSV("output/priority_" + (preemptive ? std::string("preemptive") : std::string("non_preemptive")) + "_cpu_results.csv");
+    void loadByArrival() {
+        ScratchVector<std::pair<int, int>> order(&ScratchArena::local());
+        order.reserve(processes.size());
+        for (size_t i = 0; i < processes.size(); ++i) order.push_back({processes[i].arrival_time, (int)i});
+        std::sort(order.begin(), order.end(),
+                 [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+                     PROFILE_COUNT(COMPARISONS, 1);
+                     return a < b;
+                 });
+        completed.resize(order.size());
+        for (size_t i = 0; i < order.size(); ++i) completed[i] = processes[order[i].second];
     }
 
-private:
-    void runNonPreemptivePriority() {
-        int current_time = 0;
-        std::vector<bool> executed(completed.size(), false);
+    static void recordCompletion(Process& p, int current_time) {
+        p.completion_time = current_time;
+        p.turnaround_time = current_time - p.arrival_time;
+        p.waiting_time = p.turnaround_time - p.burst_time;
+    }
 
-        for (size_t i = 0; i < completed.size(); ++i) {
-            int next_process = -1;
-            int highest_priority = -1;
+public:
+    void runRoundRobin() {
+        int time_quantum = InputValidator::getPositiveInteger("Enter time quantum (time slice per order): ", 1000);
+        runRoundRobin(time_quantum);
+    }
 
-            for (size_t j = 0; j < completed.size(); ++j) {
-                if (!executed[j] && completed[j].arrival_time <= current_time &&
-                    completed[j].priority > highest_priority) {
-                    next_process = j;
-                    highest_priority = completed[j].priority;
-                }
-            }
+    void runRoundRobin(int time_quantum) {
+        ConsoleUI::printSection("Round Robin Scheduling - Time Quantum: " + std::to_string(time_quantum));
+        scheduleCached(runKey("RR").add(time_quantum), [this, time_quantum] { scheduleRoundRobin(time_quantum); });
+        displayResults("Round Robin (TQ=" + std::to_string(time_quantum) + ")");
+        saveToCSV("output/rr_cpu_results.csv");
+    }
 
-            if (next_process == -1) {
-                for (size_t j = 0; j < completed.size(); ++j) {
-                    if (!executed[j]) {
-                        current_time = completed[j].arrival_time;
-                        next_process = j;
-                        break;
-                    }
-                }
-            }
+    void runQuantumSweep(int max_quantum, int step) {
+        ConsoleUI::printSection("Round Robin Quantum Sweep - Context Switch Cost: " + std::to_string(context_switch_cost));
 
-            if (next_process != -1) {
-                current_time += completed[next_process].burst_time;
-                completed[next_process].completion_time = current_time;
-                completed[next_process].waiting_time = current_time - completed[next_process].burst_time - completed[next_process].arrival_time;
-                completed[next_process].turnaround_time = completed[next_process].completion_time - completed[next_process].arrival_time;
-                executed[next_process] = true;
+        std::vector<std::vector<std::string>> csv_data;
+        csv_data.push_back({"Time_Quantum", "Context_Switches", "Total_Time", "Avg_Waiting_Time", "Effective_Utilization"});
+
+        std::ostringstream table;
+        table << std::left << std::setw(10) << "Quantum" << std::setw(12) << "Switches" << std::setw(12) << "Makespan"
+              << std::setw(14) << "Avg_Waiting" << "Effective_Util\n";
+        table << std::string(62, '-') << "\n";
+        table << std::fixed << std::setprecision(2);
+
+        int best_makespan_quantum = 1, best_waiting_quantum = 1;
+        int best_makespan = INT_MAX;
+        double best_waiting = 1e300;
+
+        for (int q = 1; q <= max_quantum; q += step) {
+            scheduleRoundRobin(q);
+            long long sums[8];
+            SimdKernels::sumColumns(completed.data(), completed.size(), 8, sums);
+            long long total_burst = sums[offsetof(Process, burst_time) / sizeof(int)];
+            double avg_waiting = (double)sums[offsetof(Process, waiting_time) / sizeof(int)] / std::max<size_t>(1, completed.size());
+            double effective = total_time > 0 ? total_burst * 100.0 / total_time : 0;
+
+            table << std::left << std::setw(10) << q << std::setw(12) << context_switches << std::setw(12) << total_time
+                  << std::setw(14) << avg_waiting << effective << "%\n";
+            csv_data.push_back({std::to_string(q), std::to_string(context_switches), std::to_string(total_time),
+                                std::to_string(avg_waiting), std::to_string(effective)});
+
+            if (total_time < best_makespan) {
+                best_makespan = total_time;
+                best_makespan_quantum = q;
+            }
+            if (avg_waiting < best_waiting) {
+                best_waiting = avg_waiting;
+                best_waiting_quantum = q;
             }
         }
-    }
 
-    void runPreemptivePriority() {
-        std::vector<int> remaining_time(completed.size());
-        for (size_t i = 0; i < completed.size(); ++i) {
-            remaining_time[i] = completed[i].burst_time;
+        if (ConsoleUI::showItems()) std::cout << table.str();
+        if (ConsoleUI::showSummary()) {
+            std::cout << std::fixed << std::setprecision(2);
+            std::cout << "\nBest quantum for throughput: " << best_makespan_quantum << " (makespan " << best_makespan << ")\n";
+            std::cout << "Best quantum for waiting time: " << best_waiting_quantum << " (avg " << best_waiting << ")\n";
         }
+        FileManager::writeToCSV("output/rr_quantum_sweep.csv", csv_data);
+    }
 
-        int current_time = 0;
-        int processed = 0;
-
-        while (processed < (int)completed.size()) {
-            int next_process = -1;
-            int highest_priority = -1;
+    void runMLFQ(const MLFQConfig& config) {
+        ConsoleUI::printSection("MLFQ Scheduling - " + std::to_string(config.quanta.size()) + " Levels, Priority Boost Every "
+                                + std::to_string(config.boost_period) + " Units");
+        CacheKey key = runKey("MLFQ").add(config.boost_period).add((long long)config.quanta.size());
+        for (int quantum : config.quanta) key.add(quantum);
+        scheduleCached(key, [this, &config] { scheduleMLFQ(config); });
+        displayResults("MLFQ");
+        saveToCSV("output/mlfq_cpu_results.csv");
+    }
 
-            for (size_t i = 0; i < completed.size(); ++i) {
-                if (completed[i].arrival_time <= current_time && remaining_time[i] > 0 &&
-                    completed[i].priority > highest_priority) {
-                    next_process = i;
-                    highest_priority = completed[i].priority;
-                }
+    void scheduleMLFQ(const MLFQConfig& config) {
+        PROFILE_SCOPE("CPUScheduler::scheduleMLFQ");
+        ScratchArena::Scope scratch;
+        int levels = (int)config.quanta.size();
+        beginRun();
+
+        int n = (int)completed.size();
+        ScratchArena& arena = ScratchArena::local();
+        ScratchVector<int> remaining_time(n, &arena);
+        ScratchVector<int> level(n, 0, &arena);
+        ScratchVector<bool> started(n, false, &arena);
+        for (int i = 0; i < n; ++i) remaining_time[i] = completed[i].burst_time;
+
+        ScratchPool pool(&arena);
+        ScratchVector<ScratchDeque<int>> queues(levels, &pool);
+        int next = 0;
+        int processed = 0;
+        int current_time = 0;
+        int running = -1;
+        int last_process = -1;
+        int slice_end = 0;
+        context_switches = 0;
+        int next_boost = config.boost_period > 0 ? config.boost_period : INT_MAX;
+
+        while (processed < n) {
+            while (next < n && completed[next].arrival_time <= current_time) {
+                queues[0].push_back(next++);
             }
 
-            if (next_process == -1) {
-                int next_arrival = INT_MAX;
-                for (size_t i = 0; i < completed.size(); ++i) {
-                    if (remaining_time[i] > 0 && completed[i].arrival_time < next_arrival) {
-                        next_arrival = completed[i].arrival_time;
+            if (running == -1) {
+                int l = 0;
+                while (l < levels && queues[l].empty()) l++;
+                if (l == levels) {
+                    current_time = std::max(current_time, completed[next].arrival_time);
+                    if (config.boost_period > 0 && next_boost <= current_time) {
+                        next_boost = (current_time / config.boost_period + 1) * config.boost_period;
                     }
+                    continue;
                 }
-                if (next_arrival != INT_MAX) {
-                    current_time = next_arrival;
-                }
-                continue;
+                running = queues[l].front();
+                queues[l].pop_front();
+                chargeSwitch(current_time, last_process, running);
+                recordFirstStart(started, running, current_time);
+                slice_end = current_time + std::min(config.quanta[l], remaining_time[running]);
             }
 
-            remaining_time[next_process]--;
-            current_time++;
+            int event_time = slice_end;
+            if (next < n) event_time = std::min(event_time, completed[next].arrival_time);
+            event_time = std::max(current_time, std::min(event_time, next_boost));
+
+            timeline.record(completed[running].id, current_time, event_time);
+            remaining_time[running] -= event_time - current_time;
+            current_time = event_time;
 
-            if (remaining_time[next_process] == 0) {
-                completed[next_process].completion_time = current_time;
-                completed[next_process].waiting_time = current_time - completed[next_process].burst_time - completed[next_process].arrival_time;
-                completed[next_process].turnaround_time = current_time - completed[next_process].arrival_time;
+            while (next < n && completed[next].arrival_time <= current_time) {
+                queues[0].push_back(next++);
+            }
+
+            if (remaining_time[running] == 0) {
+                recordCompletion(completed[running], current_time);
                 processed++;
+                running = -1;
+            } else if (current_time == slice_end) {
+                level[running] = std::min(level[running] + 1, levels - 1);
+                queues[level[running]].push_back(running);
+                running = -1;
+            }
+
+            if (current_time >= next_boost) {
+                for (int l = 1; l < levels; ++l) {
+                    for (int idx : queues[l]) {
+                        level[idx] = 0;
+                        queues[0].push_back(idx);
+                    }
+                    queues[l].clear();
+                }
+                if (running != -1) level[running] = 0;
+                next_boost += config.boost_period;
+            }
+
+            if (running != -1) {
+                for (int l = 0; l < level[running]; ++l) {
+                    if (!queues[l].empty()) {
+                        queues[level[running]].push_back(running);
+                        running = -1;
+                        break;
+                    }
+                }
             }
         }
-    }
 
-public:
-    void runRoundRobin() {
-        int time_quantum = InputValidator::getPositiveInteger("Enter time quantum (time slice per order): ", 1000);
-        ConsoleUI::printSection("Round Robin Scheduling - Time Quantum: " + std::to_string(time_quantum));
+        total_time = current_time;
+    }
 
-        completed = processes;
-        std::sort(completed.begin(), completed.end(),
-                 [](const Process& a, const Process& b) { return a.arrival_time < b.arrival_time; });
+    void runCFS(const CFSConfig& config) {
+        ConsoleUI::printSection("CFS Scheduling - Target Latency " + std::to_string(config.target_latency)
+                                + ", Min Granularity " + std::to_string(config.min_granularity));
+        scheduleCached(runKey("CFS").add(config.target_latency).add(config.min_granularity),
+                       [this, &config] { scheduleCFS(config); });
+        displayResults("CFS");
+        saveToCSV("output/cfs_cpu_results.csv");
+    }
 
-        std::vector<int> remaining_time(completed.size());
-        for (size_t i = 0; i < completed.size(); ++i) {
+    void scheduleCFS(const CFSConfig& config) {
+        PROFILE_SCOPE("CPUScheduler::scheduleCFS");
+        ScratchArena::Scope scratch;
+        beginRun();
+
+        const double nice_0_weight = 1024.0;
+        int n = (int)completed.size();
+        ScratchArena& arena = ScratchArena::local();
+        ScratchVector<int> remaining_time(n, &arena);
+        ScratchVector<double> weight(n, &arena);
+        ScratchVector<double> vruntime(n, 0, &arena);
+        ScratchVector<bool> started(n, false, &arena);
+        for (int i = 0; i < n; ++i) {
             remaining_time[i] = completed[i].burst_time;
+            weight[i] = nice_0_weight * std::pow(1.25, completed[i].priority - 1);
         }
 
-        std::queue<int> ready_queue;
-        int current_time = 0;
+        ScratchPool pool(&arena);
+        ScratchMultimap<double, int> run_queue(&pool);
+        double min_vruntime = 0;
+        double total_weight = 0;
+        int next = 0;
         int processed = 0;
-        std::set<int> in_queue;
+        int current_time = 0;
+        int running = -1;
+        int last_process = -1;
+        int slice_end = 0;
+        context_switches = 0;
+
+        while (processed < n) {
+            bool arrived = false;
+            while (next < n && completed[next].arrival_time <= current_time) {
+                vruntime[next] = min_vruntime;
+                run_queue.insert({vruntime[next], next});
+                PROFILE_COUNT(HEAP_OPERATIONS, 1);
+                total_weight += weight[next];
+                next++;
+                arrived = true;
+            }
 
-        for (size_t i = 0; i < completed.size(); ++i) {
-            if (completed[i].arrival_time <= current_time) {
-                ready_queue.push(i);
-                in_queue.insert(i);
+            if (running != -1 && arrived &&
+                vruntime[running] - run_queue.begin()->first > config.min_granularity) {
+                run_queue.insert({vruntime[running], running});
+                PROFILE_COUNT(HEAP_OPERATIONS, 1);
+                running = -1;
             }
-        }
 
-        while (processed < (int)completed.size()) {
-            if (ready_queue.empty()) {
-                for (size_t i = 0; i < completed.size(); ++i) {
-                    if (remaining_time[i] > 0 && completed[i].arrival_time > current_time) {
-                        current_time = completed[i].arrival_time;
-                        ready_queue.push(i);
-                        in_queue.insert(i);
-                        break;
-                    }
+            if (running == -1) {
+                if (run_queue.empty()) {
+                    current_time = std::max(current_time, completed[next].arrival_time);
+                    continue;
                 }
-                continue;
+                running = run_queue.begin()->second;
+                run_queue.erase(run_queue.begin());
+                PROFILE_COUNT(HEAP_OPERATIONS, 1);
+                chargeSwitch(current_time, last_process, running);
+                recordFirstStart(started, running, current_time);
+                int slice = std::max(config.min_granularity, (int)(config.target_latency * weight[running] / total_weight));
+                slice_end = current_time + std::min(slice, remaining_time[running]);
             }
 
-            int process_idx = ready_queue.front();
-            ready_queue.pop();
-            in_queue.erase(process_idx);
+            int event_time = slice_end;
+            if (next < n) event_time = std::max(current_time, std::min(event_time, completed[next].arrival_time));
 
-            int execution_time = std::min(time_quantum, remaining_time[process_idx]);
-            current_time += execution_time;
-            remaining_time[process_idx] -= execution_time;
+            int ran = event_time - current_time;
+            timeline.record(completed[running].id, current_time, event_time);
+            remaining_time[running] -= ran;
+            vruntime[running] += ran * nice_0_weight / weight[running];
+            current_time = event_time;
 
-            for (size_t i = 0; i < completed.size(); ++i) {
-                if (remaining_time[i] > 0 && completed[i].arrival_time <= current_time &&
-                    in_queue.find(i) == in_queue.end()) {
-                    ready_queue.push(i);
-                    in_queue.insert(i);
-                }
+            if (remaining_time[running] == 0) {
+                recordCompletion(completed[running], current_time);
+                total_weight -= weight[running];
+                processed++;
+                running = -1;
+            } else if (current_time == slice_end) {
+                run_queue.insert({vruntime[running], running});
+                PROFILE_COUNT(HEAP_OPERATIONS, 1);
+                running = -1;
             }
 
-            if (remaining_time[process_idx] > 0) {
-                ready_queue.push(process_idx);
-                in_queue.insert(process_idx);
-            } else {
-                completed[process_idx].completion_time = current_time;
-                completed[process_idx].waiting_time = current_time - completed[process_idx].burst_time - completed[process_idx].arrival_time;
-                completed[process_idx].turnaround_time = completed[process_idx].completion_time - completed[process_idx].arrival_time;
-                processed++;
+            if (running != -1 || !run_queue.empty()) {
+                double leftmost = running != -1 ? vruntime[running] : run_queue.begin()->first;
+                if (!run_queue.empty()) leftmost = std::min(leftmost, run_queue.begin()->first);
+                min_vruntime = std::max(min_vruntime, leftmost);
             }
         }
 
         total_time = current_time;
-        displayResults("Round Robin (TQ=" + std::to_string(time_quantum) + ")");
-        saveToCSV("output/rr_cpu_results.csv");
     }
 
-    void displayResults(const std::string& algorithm) {
-        double avg_waiting = 0, avg_turnaround = 0;
-        int total_burst = 0;
+    void runMultiWorker(const MultiWorkerConfig& config) {
+        ConsoleUI::printSection("Multi-Worker Scheduling - " + algorithmName(config.algorithm) + " on "
+                                + std::to_string(config.num_workers) + " Parallel Workers");
+        MultiWorkerSimulator simulator(processes, config);
+        simulator.run();
+        completed = simulator.getCompleted();
+        total_time = (int)simulator.getMakespan();
+        simulator.displayResults();
+
+        std::string name = algorithmName(config.algorithm);
+        std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+        simulator.saveToCSV("output/multi_worker_" + name + "_results.csv");
+    }
 
+    void displayResults(const std::string& algorithm) {
+        PROFILE_SCOPE("CPUScheduler::displayResults");
+        static_assert(sizeof(Process) == 8 * sizeof(int), "Process must stay a packed record of int columns");
+        long long sums[8];
+        SimdKernels::sumColumns(completed.data(), completed.size(), 8, sums);
+        long long total_burst = sums[offsetof(Process, burst_time) / sizeof(int)];
+        double avg_waiting = (double)sums[offsetof(Process, waiting_time) / sizeof(int)] / completed.size();
+        double avg_turnaround = (double)sums[offsetof(Process, turnaround_time) / sizeof(int)] / completed.size();
+        long long switch_overhead = (long long)context_switches * context_switch_cost;
+        cpu_utilization = ((total_burst + switch_overhead) * 100.0) / total_time;
+        if (!ConsoleUI::showSummary()) return;
+
+        LatencyHistogram waiting, turnaround;
         for (const auto& p : completed) {
-            avg_waiting += p.waiting_time;
-            avg_turnaround += p.turnaround_time;
-            total_burst += p.burst_time;
+            waiting.record(p.waiting_time);
+            turnaround.record(p.turnaround_time);
         }
 
-        avg_waiting /= completed.size();
-        avg_turnaround /= completed.size();
-        cpu_utilization = (total_burst * 100.0) / total_time;
-
         ConsoleUI::printSection("SCHEDULING RESULTS - " + algorithm);
         std::cout << std::fixed << std::setprecision(2);
         std::cout << "Total Time: " << total_time << " units\n";
         std::cout << "CPU Utilization: " << cpu_utilization << "%\n";
+        std::cout << "Context Switches: " << context_switches << " (" << switch_overhead << " units overhead at "
+                  << context_switch_cost << " per switch)\n";
+        std::cout << "Effective Utilization: " << (total_burst * 100.0) / total_time << "%\n";
         std::cout << "Avg Waiting Time: " << avg_waiting << " units\n";
         std::cout << "Avg Turnaround Time: " << avg_turnaround << " units\n";
-        std::cout << "Throughput: " << (completed.size() * 1.0 / total_time) << " orders/unit\n";
+        std::cout << "Throughput: " << (completed.size() * 1.0 / total_time) << " orders/unit\n\n";
+        LatencyHistogram::printTable(std::cout, "Latency (units)", {{"Waiting", &waiting}, {"Turnaround", &turnaround},
+                                                          {"Response", &response_histogram}});
     }
 
+    int getTotalTime() const { return total_time; }
+    const LatencyHistogram& getResponseHistogram() const { return response_histogram; }
+    int getContextSwitches() const { return context_switches; }
+    double getCPUUtilization() const { return cpu_utilization; }
+    const std::vector<Process>& getCompleted() const { return completed; }
+    const ExecutionTimeline& getTimeline() const { return timeline; }
+
     void saveToCSV(const std::string& filename) {
         std::vector<std::vector<std::string>> csv_data;
         csv_data.push_back({"Order_ID", "Arrival_Time", "Burst_Time", "Priority", "Completion_Time", "Waiting_Time", "Turnaround_Time"});
@@ -327,15 +537,26 @@ public:
             });
         }
 
-        std::string gantt_chart = "Gantt Chart: |";
-        for (const auto& p : completed) {
-            gantt_chart += "P" + std::to_string(p.id) + "|";
+        std::string timeline_file = filename;
+        size_t suffix = timeline_file.rfind("_results.csv");
+        if (suffix != std::string::npos) {
+            timeline_file.replace(suffix, std::string::npos, "_timeline.bin");
+        } else {
+            timeline_file += ".timeline.bin";
         }
-        csv_data.push_back({gantt_chart});
+        csv_data.push_back({"Timeline Slices", std::to_string(timeline.size()), timeline_file});
 
-        std::cout << "\n" << gantt_chart << "\n";
+        if (ConsoleUI::showItems()) {
+            std::cout << "\nGantt Chart: ";
+            timeline.renderText(std::cout, 200);
+            std::cout << "\n";
+        }
 
         FileManager::writeToCSV(filename, csv_data);
+        long long failures = AsyncWriter::instance().getFailures();
+        timeline.saveBinary(timeline_file);
+        FileManager::reportWrite("Timeline", timeline_file, AsyncWriter::instance().getFailures() == failures,
+                                 " (" + std::to_string(timeline.size()) + " slices)");
     }
 };
 
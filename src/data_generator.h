@@ -6,6 +6,31 @@
 #include <chrono>
 #include <fstream>
 #include <sstream>
+#include <memory>
+
+struct WarehouseDataset {
+    std::shared_ptr<const std::vector<Process>> processes;
+    std::shared_ptr<const std::vector<MemoryBlock>> memory_blocks;
+    std::shared_ptr<const std::vector<DiskRequest>> disk_requests;
+    int warehouse_size;
+    int max_process_size;
+    int max_disk_size;
+    int head_position;
+    int buffer_size;
+};
+
+struct GeneratorConfig {
+    int num_processes;
+    int max_burst_time;
+    int max_priority;
+    int warehouse_size;
+    int max_block_size;
+    int max_process_size;
+    int num_disk_requests;
+    int max_disk_size;
+    int head_position;
+    int buffer_size;
+};
 
 class WarehouseDataGenerator {
 private:
@@ -24,12 +49,18 @@ private:
     int buffer_size;
 
     unsigned seed;
+    WarehouseDataset dataset;
 
 public:
-    WarehouseDataGenerator() : seed(std::chrono::system_clock::now().time_since_epoch().count()) {}
+    WarehouseDataGenerator() : seed(std::chrono::system_clock::now().time_since_epoch().count()) {
+        dataset = WarehouseDataset{std::make_shared<const std::vector<Process>>(),
+                                   std::make_shared<const std::vector<MemoryBlock>>(),
+                                   std::make_shared<const std::vector<DiskRequest>>(), 0, 0, 0, 0, 0};
+    }
 
     void generateAllData(bool use_saved_data = false) {
         if (use_saved_data && loadFromFile()) {
+            publish();
             ConsoleUI::printSuccess("Loaded previously saved warehouse data");
             return;
         }
@@ -55,14 +86,71 @@ public:
         std::cout << "\n📊 BUFFER & SYNCHRONIZATION CONFIGURATION:\n";
         buffer_size = InputValidator::getPositiveInteger("  Stock buffer capacity: ");
 
+        PROFILE_SCOPE("WarehouseDataGenerator::generateAllData");
         generateProcesses();
         generateMemoryBlocks();
         generateDiskRequests();
         saveToFile();
         printStatistics();
+        publish();
+    }
+
+    void generateFromConfig(const GeneratorConfig& config) {
+        num_processes = config.num_processes;
+        max_burst_time = config.max_burst_time;
+        max_priority = config.max_priority;
+        warehouse_size = config.warehouse_size;
+        max_block_size = config.max_block_size;
+        max_process_size = config.max_process_size;
+        num_disk_requests = config.num_disk_requests;
+        max_disk_size = config.max_disk_size;
+        head_position = config.head_position;
+        buffer_size = config.buffer_size;
+
+        PROFILE_SCOPE("WarehouseDataGenerator::generateFromConfig");
+        generateProcesses();
+        generateMemoryBlocks();
+        generateDiskRequests();
+        publish();
+    }
+
+    void setSeed(unsigned new_seed) { seed = new_seed; }
+    unsigned getSeed() const { return seed; }
+
+    void useImportedOrders(std::vector<Process> orders, int largest_order) {
+        num_processes = (int)orders.size();
+        max_process_size = std::max(max_process_size, largest_order);
+        dataset.processes = std::make_shared<const std::vector<Process>>(std::move(orders));
+        dataset.max_process_size = max_process_size;
+    }
+
+    void useImportedTrucks(std::vector<DiskRequest> trucks) {
+        num_disk_requests = (int)trucks.size();
+        for (const auto& truck : trucks) max_disk_size = std::max(max_disk_size, truck.cylinder);
+        dataset.disk_requests = std::make_shared<const std::vector<DiskRequest>>(std::move(trucks));
+        dataset.max_disk_size = max_disk_size;
+    }
+
+    GeneratorConfig getConfig() const {
+        return GeneratorConfig{num_processes, max_burst_time, max_priority, warehouse_size, max_block_size,
+                               max_process_size, num_disk_requests, max_disk_size, head_position, buffer_size};
     }
 
 private:
+    void publish() {
+        dataset.processes = std::make_shared<const std::vector<Process>>(std::move(processes));
+        dataset.memory_blocks = std::make_shared<const std::vector<MemoryBlock>>(std::move(memory_blocks));
+        dataset.disk_requests = std::make_shared<const std::vector<DiskRequest>>(std::move(disk_requests));
+        dataset.warehouse_size = warehouse_size;
+        dataset.max_process_size = max_process_size;
+        dataset.max_disk_size = max_disk_size;
+        dataset.head_position = head_position;
+        dataset.buffer_size = buffer_size;
+        processes = std::vector<Process>();
+        memory_blocks = std::vector<MemoryBlock>();
+        disk_requests = std::vector<DiskRequest>();
+    }
+
     void generateProcesses() {
         std::mt19937 gen(seed);
         std::uniform_int_distribution<> arrival_dist(0, max_burst_time * 2);
@@ -79,6 +167,7 @@ private:
             p.completion_time = 0;
             p.waiting_time = 0;
             p.turnaround_time = 0;
+            p.size = p.burst_time;
             processes.push_back(p);
         }
         std::sort(processes.begin(), processes.end(),
@@ -107,7 +196,7 @@ private:
     void generateDiskRequests() {
         std::mt19937 gen(seed + 2);
         std::uniform_int_distribution<> cylinder_dist(0, max_disk_size);
-        std::uniform_int_distribution<> arrival_dist(0, num_processes * max_burst_time / 2);
+        std::uniform_int_distribution<> arrival_dist(0, (int)std::min<long long>(INT_MAX, (long long)num_processes * max_burst_time / 2));
 
         disk_requests.clear();
         for (int i = 0; i < num_disk_requests; ++i) {
@@ -168,6 +257,7 @@ private:
                 char comma;
                 iss >> p.id >> comma >> p.arrival_time >> comma >> p.burst_time >> comma >> p.priority;
                 p.completion_time = p.waiting_time = p.turnaround_time = 0;
+                p.size = p.burst_time;
                 processes.push_back(p);
             }
 
@@ -200,18 +290,21 @@ private:
     }
 
     void printStatistics() {
+        if (!ConsoleUI::showSummary()) return;
         ConsoleUI::printSection("GENERATED DATA STATISTICS");
-        std::cout << "✓ Processes: " << num_processes << std::endl;
-        std::cout << "✓ Memory Blocks: " << memory_blocks.size() << std::endl;
-        std::cout << "✓ Disk Requests: " << num_disk_requests << std::endl;
+        std::cout << "✓ Seed: " << seed << "\n";
+        std::cout << "✓ Processes: " << num_processes << "\n";
+        std::cout << "✓ Memory Blocks: " << memory_blocks.size() << "\n";
+        std::cout << "✓ Disk Requests: " << num_disk_requests << "\n";
         std::cout << "✓ Warehouse Capacity: " << warehouse_size << " units\n";
         std::cout << "✓ Buffer Capacity: " << buffer_size << " units\n";
     }
 
 public:
-    const std::vector<Process>& getProcesses() const { return processes; }
-    const std::vector<MemoryBlock>& getMemoryBlocks() const { return memory_blocks; }
-    const std::vector<DiskRequest>& getDiskRequests() const { return disk_requests; }
+    const WarehouseDataset& getDataset() const { return dataset; }
+    const std::vector<Process>& getProcesses() const { return *dataset.processes; }
+    const std::vector<MemoryBlock>& getMemoryBlocks() const { return *dataset.memory_blocks; }
+    const std::vector<DiskRequest>& getDiskRequests() const { return *dataset.disk_requests; }
     int getWarehouseSize() const { return warehouse_size; }
     int getMaxProcessSize() const { return max_process_size; }
     int getMaxDiskSize() const { return max_disk_size; }
@@ -2,198 +2,163 @@
 #define DISK_SCHEDULER_H
 
 #include "utilities.h"
+#include "scheduling_policies.h"
+#include "latency_histogram.h"
+#include "result_cache.h"
 #include <algorithm>
 #include <cmath>
+#include <memory>
 
 class DiskScheduler {
 private:
-    std::vector<DiskRequest> requests;
+    std::shared_ptr<const std::vector<DiskRequest>> shared_requests;
+    const std::vector<DiskRequest>& requests;
     int head_position;
     int disk_size;
     std::vector<int> head_sequence;
     int total_seek_time;
+    LatencyHistogram seek_histogram;
+    ResultCache* result_cache;
+    uint64_t dataset_hash;
 
 public:
-    DiskScheduler(const std::vector<DiskRequest>& reqs, int head_pos, int size)
-        : requests(reqs), head_position(head_pos), disk_size(size), total_seek_time(0) {}
+    explicit DiskScheduler(std::shared_ptr<const std::vector<DiskRequest>> reqs, int head_pos, int size)
+        : shared_requests(std::move(reqs)), requests(*shared_requests), head_position(head_pos), disk_size(size),
+          total_seek_time(0), result_cache(nullptr), dataset_hash(0) {}
 
-    void runFCFS() {
-        ConsoleUI::printSection("FCFS Disk Scheduling - Trucks Dispatched by Arrival Order");
-        head_sequence.clear();
-        total_seek_time = 0;
-        head_sequence.push_back(head_position);
-
-        std::sort(requests.begin(), requests.end(),
-                 [](const DiskRequest& a, const DiskRequest& b) { return a.arrival_time < b.arrival_time; });
+    explicit DiskScheduler(const std::vector<DiskRequest>& reqs, int head_pos, int size)
+        : DiskScheduler(std::make_shared<const std::vector<DiskRequest>>(reqs), head_pos, size) {}
 
-        for (const auto& req : requests) {
-            int seek = std::abs(req.cylinder - head_position);
-            total_seek_time += seek;
-            head_position = req.cylinder;
-            head_sequence.push_back(head_position);
-        }
+    void setResultCache(ResultCache* cache, uint64_t hash) {
+        result_cache = cache;
+        dataset_hash = hash;
+    }
 
+    void runFCFS() {
+        ConsoleUI::printSection("FCFS Disk Scheduling - Trucks Dispatched by Arrival Order");
+        scheduleCached(DiskAlgorithm::FCFS, true);
         displayResults("FCFS");
         saveToCSV("output/fcfs_disk_results.csv");
     }
 
+    void scheduleFCFS() {
+        PROFILE_SCOPE("DiskScheduler::scheduleFCFS");
+        ScratchArena::Scope scratch;
+        ScratchVector<const DiskRequest*> arrival_order(&ScratchArena::local());
+        arrival_order.reserve(requests.size());
+        for (const auto& req : requests) arrival_order.push_back(&req);
+        std::sort(arrival_order.begin(), arrival_order.end(),
+                 [](const DiskRequest* a, const DiskRequest* b) {
+                     PROFILE_COUNT(COMPARISONS, 1);
+                     return a->arrival_time < b->arrival_time;
+                 });
+
+        HeadTracker head(head_position, head_sequence, seek_histogram);
+        for (const DiskRequest* req : arrival_order) head.moveTo(req->cylinder);
+        total_seek_time = head.finish();
+    }
+
     void runSSTF() {
         ConsoleUI::printSection("SSTF Disk Scheduling - Nearest Dock Served First");
-        head_sequence.clear();
-        total_seek_time = 0;
-        head_sequence.push_back(head_position);
-
-        std::vector<bool> visited(requests.size(), false);
-
-        for (size_t i = 0; i < requests.size(); ++i) {
-            int nearest = -1;
-            int min_distance = INT_MAX;
-
-            for (size_t j = 0; j < requests.size(); ++j) {
-                if (!visited[j]) {
-                    int distance = std::abs(requests[j].cylinder - head_position);
-                    if (distance < min_distance) {
-                        min_distance = distance;
-                        nearest = j;
-                    }
-                }
-            }
-
-            if (nearest != -1) {
-                visited[nearest] = true;
-                total_seek_time += min_distance;
-                head_position = requests[nearest].cylinder;
-                head_sequence.push_back(head_position);
-            }
-        }
-
+        scheduleCached(DiskAlgorithm::SSTF, true);
         displayResults("SSTF");
         saveToCSV("output/sstf_disk_results.csv");
     }
 
+    void scheduleSSTF() {
+        PROFILE_SCOPE("DiskScheduler::scheduleSSTF");
+        runSweep<NearestFirstSweep>(true);
+    }
+
     void runSCAN() {
         ConsoleUI::printSection("SCAN Disk Scheduling - Forklift Moves in One Direction");
         char direction = InputValidator::getYesNo("Start moving towards higher dock numbers");
-        bool move_up = (direction == 'y' || direction == 'Y');
-
-        head_sequence.clear();
-        total_seek_time = 0;
-        head_sequence.push_back(head_position);
-
-        std::vector<int> cylinders;
-        for (const auto& req : requests) {
-            cylinders.push_back(req.cylinder);
-        }
-        std::sort(cylinders.begin(), cylinders.end());
-
-        if (move_up) {
-            for (int cyl : cylinders) {
-                if (cyl >= head_position) {
-                    total_seek_time += std::abs(cyl - head_position);
-                    head_position = cyl;
-                    head_sequence.push_back(head_position);
-                }
-            }
-            for (int i = (int)cylinders.size() - 1; i >= 0; --i) {
-                if (cylinders[i] < head_position) {
-                    total_seek_time += std::abs(cylinders[i] - head_position);
-                    head_position = cylinders[i];
-                    head_sequence.push_back(head_position);
-                }
-            }
-        } else {
-            for (int i = (int)cylinders.size() - 1; i >= 0; --i) {
-                if (cylinders[i] <= head_position) {
-                    total_seek_time += std::abs(cylinders[i] - head_position);
-                    head_position = cylinders[i];
-                    head_sequence.push_back(head_position);
-                }
-            }
-            for (int cyl : cylinders) {
-                if (cyl > head_position) {
-                    total_seek_time += std::abs(cyl - head_position);
-                    head_position = cyl;
-                    head_sequence.push_back(head_position);
-                }
-            }
-        }
-
+        scheduleCached(DiskAlgorithm::SCAN, direction == 'y' || direction == 'Y');
         displayResults("SCAN");
         saveToCSV("output/scan_disk_results.csv");
     }
 
+    void scheduleSCAN(bool move_up) {
+        PROFILE_SCOPE("DiskScheduler::scheduleSCAN");
+        runSweep<ElevatorSweep>(move_up);
+    }
+
     void runCSCAN() {
         ConsoleUI::printSection("C-SCAN Disk Scheduling - Circular Forklift Movement");
         char direction = InputValidator::getYesNo("Start moving towards higher dock numbers");
-        bool move_up = (direction == 'y' || direction == 'Y');
+        scheduleCached(DiskAlgorithm::CSCAN, direction == 'y' || direction == 'Y');
+        displayResults("C-SCAN");
+        saveToCSV("output/cscan_disk_results.csv");
+    }
 
-        head_sequence.clear();
-        total_seek_time = 0;
-        head_sequence.push_back(head_position);
+    void scheduleCSCAN(bool move_up) {
+        PROFILE_SCOPE("DiskScheduler::scheduleCSCAN");
+        runSweep<CircularSweep>(move_up);
+    }
 
-        std::vector<int> cylinders;
-        for (const auto& req : requests) {
-            cylinders.push_back(req.cylinder);
+    void schedule(DiskAlgorithm algorithm, bool move_up = true) {
+        switch (algorithm) {
+            case DiskAlgorithm::FCFS: scheduleFCFS(); break;
+            case DiskAlgorithm::SSTF: scheduleSSTF(); break;
+            case DiskAlgorithm::SCAN: scheduleSCAN(move_up); break;
+            case DiskAlgorithm::CSCAN: scheduleCSCAN(move_up); break;
         }
-        std::sort(cylinders.begin(), cylinders.end());
-
-        if (move_up) {
-            for (int cyl : cylinders) {
-                if (cyl >= head_position) {
-                    total_seek_time += std::abs(cyl - head_position);
-                    head_position = cyl;
-                    head_sequence.push_back(head_position);
-                }
-            }
-            total_seek_time += std::abs(disk_size - head_position);
-            total_seek_time += disk_size;
-            head_position = 0;
-            head_sequence.push_back(head_position);
-            for (int cyl : cylinders) {
-                if (cyl < head_position) {
-                    total_seek_time += std::abs(cyl - head_position);
-                    head_position = cyl;
-                    head_sequence.push_back(head_position);
-                }
-            }
-        } else {
-            for (int i = (int)cylinders.size() - 1; i >= 0; --i) {
-                if (cylinders[i] <= head_position) {
-                    total_seek_time += std::abs(cylinders[i] - head_position);
-                    head_position = cylinders[i];
-                    head_sequence.push_back(head_position);
-                }
-            }
-            total_seek_time += head_position;
-            head_position = disk_size;
-            head_sequence.push_back(head_position);
-            total_seek_time += disk_size;
-            for (int i = (int)cylinders.size() - 1; i >= 0; --i) {
-                if (cylinders[i] > head_position) {
-                    total_seek_time += std::abs(cylinders[i] - head_position);
-                    head_position = cylinders[i];
-                    head_sequence.push_back(head_position);
-                }
-            }
+    }
+
+    int getTotalSeekTime() const { return total_seek_time; }
+    const std::vector<int>& getHeadSequence() const { return head_sequence; }
+    const LatencyHistogram& getSeekHistogram() const { return seek_histogram; }
+
+private:
+    void scheduleCached(DiskAlgorithm algorithm, bool move_up) {
+        CacheKey key = CacheKey().add((long long)dataset_hash).add("truck").add((int)algorithm).add(move_up);
+        key.add(head_position).add(disk_size);
+        CacheRecord record;
+        if (result_cache && result_cache->load(key, record) && record.getVector(head_sequence) && record.get(total_seek_time) &&
+            seek_histogram.load(record) && record.good()) {
+            return;
         }
+        schedule(algorithm, move_up);
+        if (!result_cache) return;
+        CacheRecord saved;
+        saved.putVector(head_sequence);
+        saved.put(total_seek_time);
+        seek_histogram.save(saved);
+        result_cache->store(key, saved);
+    }
 
-        displayResults("C-SCAN");
-        saveToCSV("output/cscan_disk_results.csv");
+    template <typename SweepPolicy>
+    void runSweep(bool move_up) {
+        ScratchArena::Scope scratch;
+        DockQueue docks(&ScratchArena::local());
+        docks.reserve(requests.size());
+        for (size_t i = 0; i < requests.size(); ++i) docks.push_back({requests[i].cylinder, (int)i});
+        std::sort(docks.begin(), docks.end());
+
+        HeadTracker head(head_position, head_sequence, seek_histogram);
+        SweepPolicy::sweep(docks, disk_size, move_up, head);
+        total_seek_time = head.finish();
     }
 
-private:
     void displayResults(const std::string& algorithm) {
+        PROFILE_SCOPE("DiskScheduler::displayResults");
+        if (!ConsoleUI::showSummary()) return;
         ConsoleUI::printSection("DISK SCHEDULING RESULTS - " + algorithm);
-        std::cout << "Head Sequence: ";
-        for (size_t i = 0; i < head_sequence.size(); ++i) {
-            std::cout << head_sequence[i];
-            if (i < head_sequence.size() - 1) std::cout << " -> ";
+        if (ConsoleUI::showItems()) {
+            std::string sequence = "Head Sequence: ";
+            for (size_t i = 0; i < head_sequence.size(); ++i) {
+                if (i > 0) sequence += " -> ";
+                sequence += std::to_string(head_sequence[i]);
+            }
+            sequence += "\n";
+            std::cout << sequence;
         }
-        std::cout << "\n";
 
         std::cout << "Total Seek Time: " << total_seek_time << " units\n";
         std::cout << std::fixed << std::setprecision(2);
-        std::cout << "Avg Seek Time: " << (requests.empty() ? 0 : total_seek_time / (double)requests.size()) << " units\n";
+        std::cout << "Avg Seek Time: " << (requests.empty() ? 0 : total_seek_time / (double)requests.size()) << " units\n\n";
+
+        LatencyHistogram::printTable(std::cout, "Seek (cylinders)", {{"Seek Distance", &seek_histogram}});
     }
 
     void saveToCSV(const std::string& filename) {
@@ -0,0 +1,180 @@
+#ifndef EXECUTION_TIMELINE_H
+#define EXECUTION_TIMELINE_H
+
+#include "utilities.h"
+#include <cstdint>
+
+struct TimelineSlice {
+    int order_id;
+    int start;
+    int end;
+};
+
+class ExecutionTimeline {
+private:
+    static constexpr char MAGIC[4] = {'W', 'H', 'T', 'L'};
+    static constexpr uint32_t FORMAT_VERSION = 1;
+    static constexpr size_t IO_CHUNK = 1 << 16;
+
+    std::vector<TimelineSlice> slices;
+
+public:
+    void reset(size_t expected_slices) {
+        slices.clear();
+        slices.reserve(expected_slices);
+    }
+
+    void record(int order_id, int start, int end) {
+        if (end <= start) return;
+        if (!slices.empty() && slices.back().order_id == order_id && slices.back().end == start) {
+            slices.back().end = end;
+            return;
+        }
+        slices.push_back({order_id, start, end});
+    }
+
+    size_t size() const { return slices.size(); }
+    const std::vector<TimelineSlice>& getSlices() const { return slices; }
+
+    void saveBinary(const std::string& filename) const {
+        PROFILE_SCOPE("ExecutionTimeline::saveBinary");
+        std::string bytes(MAGIC, sizeof(MAGIC));
+        bytes.reserve(sizeof(MAGIC) + sizeof(FORMAT_VERSION) + sizeof(uint64_t) + slices.size() * 4);
+        appendRaw(bytes, FORMAT_VERSION);
+        appendRaw(bytes, (uint64_t)slices.size());
+
+        int previous_end = 0;
+        for (const auto& slice : slices) {
+            appendVarint(bytes, zigzag(slice.start - previous_end));
+            appendVarint(bytes, (uint32_t)(slice.end - slice.start));
+            appendVarint(bytes, (uint32_t)slice.order_id);
+            previous_end = slice.end;
+        }
+        AsyncWriter::instance().submit(filename, std::move(bytes));
+    }
+
+    void renderText(std::ostream& out, size_t max_slices) const {
+        std::string chunk;
+        chunk.reserve(IO_CHUNK + 64);
+        size_t shown = std::min(max_slices, slices.size());
+        for (size_t i = 0; i < shown; ++i) {
+            appendSlice(chunk, slices[i]);
+            if (chunk.size() >= IO_CHUNK) {
+                out.write(chunk.data(), chunk.size());
+                chunk.clear();
+            }
+        }
+        chunk += "|";
+        if (shown < slices.size()) chunk += " ... (" + std::to_string(slices.size() - shown) + " more slices)";
+        out.write(chunk.data(), chunk.size());
+    }
+
+    static bool renderBinaryFile(const std::string& filename, std::ostream& out) {
+        std::ifstream file(filename, std::ios::binary);
+        char magic[4];
+        uint32_t version = 0;
+        uint64_t count = 0;
+        if (!file.read(magic, sizeof(magic)) || std::string(magic, 4) != std::string(MAGIC, 4) ||
+            !readRaw(file, version) || version != FORMAT_VERSION || !readRaw(file, count)) {
+            std::cerr << "❌ Error: " << filename << " is not a timeline file" << std::endl;
+            return false;
+        }
+
+        std::vector<char> input(IO_CHUNK);
+        size_t input_pos = 0, input_len = 0;
+        auto nextByte = [&](uint8_t& byte) {
+            if (input_pos == input_len) {
+                file.read(input.data(), input.size());
+                input_len = (size_t)file.gcount();
+                input_pos = 0;
+                if (input_len == 0) return false;
+            }
+            byte = (uint8_t)input[input_pos++];
+            return true;
+        };
+        auto readVarint = [&](uint32_t& value) {
+            value = 0;
+            uint8_t byte = 0;
+            for (int shift = 0; shift < 35; shift += 7) {
+                if (!nextByte(byte)) return false;
+                value |= (uint32_t)(byte & 0x7F) << shift;
+                if (!(byte & 0x80)) return true;
+            }
+            return false;
+        };
+
+        std::string chunk;
+        chunk.reserve(IO_CHUNK + 64);
+        int previous_end = 0;
+        for (uint64_t i = 0; i < count; ++i) {
+            uint32_t gap, duration, order_id;
+            if (!readVarint(gap) || !readVarint(duration) || !readVarint(order_id)) {
+                std::cerr << "❌ Error: " << filename << " is truncated after " << i << " slices" << std::endl;
+                return false;
+            }
+            TimelineSlice slice;
+            slice.order_id = (int)order_id;
+            slice.start = previous_end + unzigzag(gap);
+            slice.end = slice.start + (int)duration;
+            previous_end = slice.end;
+            appendSlice(chunk, slice);
+            chunk += "\n";
+            if (chunk.size() >= IO_CHUNK) {
+                out.write(chunk.data(), chunk.size());
+                chunk.clear();
+            }
+        }
+        out.write(chunk.data(), chunk.size());
+        return true;
+    }
+
+private:
+    template <typename T>
+    static void appendRaw(std::string& bytes, T value) {
+        bytes.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    static bool readRaw(std::ifstream& file, T& value) {
+        return (bool)file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+
+    static uint32_t zigzag(int value) {
+        return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+    }
+
+    static int unzigzag(uint32_t value) {
+        return (int)(value >> 1) ^ -(int)(value & 1);
+    }
+
+    static void appendVarint(std::string& out, uint32_t value) {
+        while (value >= 0x80) {
+            out.push_back((char)((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        out.push_back((char)value);
+    }
+
+    static void appendInt(std::string& out, int value) {
+        char digits[16];
+        int len = 0;
+        unsigned magnitude = value < 0 ? -(unsigned)value : (unsigned)value;
+        do {
+            digits[len++] = (char)('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude > 0);
+        if (value < 0) out.push_back('-');
+        while (len > 0) out.push_back(digits[--len]);
+    }
+
+    static void appendSlice(std::string& out, const TimelineSlice& slice) {
+        out += "|P";
+        appendInt(out, slice.order_id);
+        out.push_back(' ');
+        appendInt(out, slice.start);
+        out.push_back('-');
+        appendInt(out, slice.end);
+    }
+};
+
+#endif
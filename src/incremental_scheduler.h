@@ -0,0 +1,284 @@
+#ifndef INCREMENTAL_SCHEDULER_H
+#define INCREMENTAL_SCHEDULER_H
+
+#include "utilities.h"
+#include "execution_timeline.h"
+#include "latency_histogram.h"
+#include <set>
+#include <functional>
+#include <tuple>
+#include <unordered_map>
+
+class IncrementalScheduler {
+private:
+    enum class OrderStatus {
+        PENDING,
+        READY,
+        RUNNING
+    };
+
+    struct OrderState {
+        Process process;
+        int remaining;
+        long long sequence;
+        OrderStatus status;
+        bool started;
+    };
+
+    using PendingKey = std::tuple<int, long long, int>;
+    using ReadyKey = std::tuple<long long, long long, int>;
+
+    CPUAlgorithm algorithm;
+    int time_quantum;
+    int context_switch_cost;
+    int current_time;
+    int running;
+    int slice_end;
+    int last_dispatched;
+    int context_switches;
+    int cancelled;
+    long long next_sequence;
+    std::unordered_map<int, OrderState> orders;
+    std::set<PendingKey> pending;
+    std::set<ReadyKey> ready;
+    std::vector<Process> completed;
+    std::function<void(const Process&)> completion_sink;
+    ExecutionTimeline timeline;
+    bool record_timeline;
+    long long completed_count;
+    long long total_waiting;
+    long long total_turnaround;
+    LatencyHistogram waiting_histogram;
+    LatencyHistogram turnaround_histogram;
+    LatencyHistogram response_histogram;
+    size_t peak_live_orders;
+
+public:
+    IncrementalScheduler(CPUAlgorithm algo, int quantum = 1)
+        : algorithm(algo), time_quantum(std::max(1, quantum)), context_switch_cost(0), current_time(0), running(-1),
+          slice_end(0), last_dispatched(-1), context_switches(0), cancelled(0), next_sequence(0), record_timeline(true),
+          completed_count(0), total_waiting(0), total_turnaround(0), peak_live_orders(0) {}
+
+    void setContextSwitchCost(int cost) { context_switch_cost = std::max(0, cost); }
+    void setTimelineEnabled(bool enabled) { record_timeline = enabled; }
+    void setCompletionSink(std::function<void(const Process&)> sink) { completion_sink = std::move(sink); }
+
+    bool addOrder(const Process& order) {
+        if (orders.count(order.id)) return false;
+
+        OrderState state{order, order.burst_time, next_sequence++, OrderStatus::PENDING, false};
+        state.process.arrival_time = std::max(order.arrival_time, current_time);
+        state.process.completion_time = state.process.waiting_time = state.process.turnaround_time = 0;
+        if (state.remaining <= 0) return false;
+
+        orders[order.id] = state;
+        pending.insert(PendingKey{state.process.arrival_time, state.sequence, order.id});
+        peak_live_orders = std::max(peak_live_orders, orders.size());
+        return true;
+    }
+
+    bool cancelOrder(int order_id) {
+        auto it = orders.find(order_id);
+        if (it == orders.end()) return false;
+        OrderState& state = it->second;
+
+        switch (state.status) {
+            case OrderStatus::PENDING:
+                pending.erase(PendingKey{state.process.arrival_time, state.sequence, order_id});
+                break;
+            case OrderStatus::READY:
+                ready.erase(readyKey(order_id));
+                break;
+            case OrderStatus::RUNNING:
+                running = -1;
+                break;
+        }
+        orders.erase(it);
+        cancelled++;
+        return true;
+    }
+
+    void advanceTo(int target_time) { advance(target_time); }
+
+    void runToCompletion() { advance(LLONG_MAX); }
+
+    int getCurrentTime() const { return current_time; }
+    int getContextSwitches() const { return context_switches; }
+    int getCancelledCount() const { return cancelled; }
+    int getRunningOrder() const { return running; }
+    size_t getReadyCount() const { return ready.size(); }
+    size_t getPendingCount() const { return pending.size(); }
+    long long getCompletedCount() const { return completed_count; }
+    size_t getLiveOrderCount() const { return orders.size(); }
+    size_t getPeakLiveOrders() const { return peak_live_orders; }
+    const std::vector<Process>& getCompleted() const { return completed; }
+    const ExecutionTimeline& getTimeline() const { return timeline; }
+    const LatencyHistogram& getWaitingHistogram() const { return waiting_histogram; }
+    const LatencyHistogram& getTurnaroundHistogram() const { return turnaround_histogram; }
+    const LatencyHistogram& getResponseHistogram() const { return response_histogram; }
+
+    void displayState() const {
+        if (!ConsoleUI::showSummary()) return;
+        std::cout << "Clock: " << current_time << " | Running: " << (running == -1 ? std::string("idle") : "P" + std::to_string(running))
+                  << " | Ready: " << ready.size() << " | Not yet arrived: " << pending.size()
+                  << " | Completed: " << completed_count << " | Cancelled: " << cancelled << "\n";
+    }
+
+    void displayResults() const {
+        if (!ConsoleUI::showSummary()) return;
+        double done = std::max<long long>(1, completed_count);
+
+        ConsoleUI::printSection("INCREMENTAL SCHEDULING RESULTS - " + algorithmName(algorithm));
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "Shift End: " << current_time << " units\n";
+        std::cout << "Orders Completed: " << completed_count << " | Cancelled: " << cancelled << "\n";
+        std::cout << "Context Switches: " << context_switches << "\n";
+        std::cout << "Avg Waiting Time: " << total_waiting / done << " units\n";
+        std::cout << "Avg Turnaround Time: " << total_turnaround / done << " units\n\n";
+        LatencyHistogram::printTable(std::cout, "Latency (units)", {{"Waiting", &waiting_histogram}, {"Turnaround", &turnaround_histogram},
+                                                          {"Response", &response_histogram}});
+    }
+
+    void saveToCSV(const std::string& filename) const {
+        std::vector<std::vector<std::string>> csv_data;
+        csv_data.push_back({"Order_ID", "Arrival_Time", "Burst_Time", "Priority", "Completion_Time", "Waiting_Time", "Turnaround_Time"});
+        for (const auto& p : completed) {
+            csv_data.push_back({
+                std::to_string(p.id),
+                std::to_string(p.arrival_time),
+                std::to_string(p.burst_time),
+                std::to_string(p.priority),
+                std::to_string(p.completion_time),
+                std::to_string(p.waiting_time),
+                std::to_string(p.turnaround_time)
+            });
+        }
+        csv_data.push_back({"Cancelled Orders", std::to_string(cancelled)});
+        FileManager::writeToCSV(filename, csv_data);
+    }
+
+private:
+    bool isPreemptive() const {
+        return algorithm == CPUAlgorithm::SRJF || algorithm == CPUAlgorithm::PRIORITY_PREEMPTIVE;
+    }
+
+    ReadyKey readyKey(int order_id) const {
+        const OrderState& state = orders.at(order_id);
+        long long key = 0;
+        switch (algorithm) {
+            case CPUAlgorithm::FCFS: key = state.process.arrival_time; break;
+            case CPUAlgorithm::SJF: key = state.process.burst_time; break;
+            case CPUAlgorithm::SRJF: key = state.remaining; break;
+            case CPUAlgorithm::PRIORITY_NON_PREEMPTIVE:
+            case CPUAlgorithm::PRIORITY_PREEMPTIVE: key = -state.process.priority; break;
+            case CPUAlgorithm::ROUND_ROBIN: key = 0; break;
+        }
+        return ReadyKey{key, state.sequence, order_id};
+    }
+
+    bool beats(int candidate, int current) const {
+        const OrderState& c = orders.at(candidate);
+        const OrderState& r = orders.at(current);
+        if (r.remaining == 0) return false;
+        if (algorithm == CPUAlgorithm::SRJF) return c.remaining < r.remaining;
+        if (algorithm == CPUAlgorithm::PRIORITY_PREEMPTIVE) return c.process.priority > r.process.priority;
+        return false;
+    }
+
+    void makeReady(int order_id) {
+        OrderState& state = orders.at(order_id);
+        state.status = OrderStatus::READY;
+        state.sequence = next_sequence++;
+        ready.insert(readyKey(order_id));
+    }
+
+    void admitArrivals() {
+        while (!pending.empty() && std::get<0>(*pending.begin()) <= current_time) {
+            int order_id = std::get<2>(*pending.begin());
+            pending.erase(pending.begin());
+            makeReady(order_id);
+            if (running != -1 && isPreemptive() && beats(order_id, running)) {
+                makeReady(running);
+                running = -1;
+            }
+        }
+    }
+
+    void dispatch() {
+        if (ready.empty()) return;
+        running = std::get<2>(*ready.begin());
+        ready.erase(ready.begin());
+        if (last_dispatched != -1 && last_dispatched != running) {
+            context_switches++;
+            current_time += context_switch_cost;
+        }
+        last_dispatched = running;
+
+        OrderState& state = orders.at(running);
+        state.status = OrderStatus::RUNNING;
+        if (!state.started) {
+            state.started = true;
+            response_histogram.record(current_time - state.process.arrival_time);
+        }
+        int length = algorithm == CPUAlgorithm::ROUND_ROBIN ? std::min(time_quantum, state.remaining) : state.remaining;
+        slice_end = current_time + length;
+    }
+
+    void runUntil(int time) {
+        OrderState& state = orders.at(running);
+        if (record_timeline) timeline.record(running, current_time, time);
+        state.remaining -= time - current_time;
+        current_time = time;
+    }
+
+    void advance(long long target_time) {
+        while (true) {
+            admitArrivals();
+            if (running == -1) dispatch();
+
+            long long next_arrival = pending.empty() ? LLONG_MAX : std::get<0>(*pending.begin());
+            if (running == -1) {
+                if (pending.empty() || next_arrival > target_time) {
+                    if (target_time != LLONG_MAX) current_time = std::max<long long>(current_time, target_time);
+                    return;
+                }
+                current_time = (int)next_arrival;
+                continue;
+            }
+
+            long long event_time = std::min<long long>(slice_end, next_arrival);
+            if (event_time > target_time) {
+                runUntil(std::max(current_time, (int)target_time));
+                return;
+            }
+            runUntil((int)std::max<long long>(current_time, event_time));
+            admitArrivals();
+            if (running == -1) continue;
+
+            OrderState& state = orders.at(running);
+            if (state.remaining == 0) {
+                Process p = state.process;
+                p.completion_time = current_time;
+                p.turnaround_time = current_time - p.arrival_time;
+                p.waiting_time = p.turnaround_time - p.burst_time;
+                completed_count++;
+                total_waiting += p.waiting_time;
+                total_turnaround += p.turnaround_time;
+                waiting_histogram.record(p.waiting_time);
+                turnaround_histogram.record(p.turnaround_time);
+                if (completion_sink) {
+                    completion_sink(p);
+                } else {
+                    completed.push_back(p);
+                }
+                orders.erase(running);
+                running = -1;
+            } else if (current_time == slice_end) {
+                makeReady(running);
+                running = -1;
+            }
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,175 @@
+#ifndef INVENTORY_STORE_H
+#define INVENTORY_STORE_H
+
+#include "utilities.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <algorithm>
+
+struct InventoryLine {
+    int sku;
+    long long units;
+};
+
+struct InventorySnapshot {
+    std::vector<long long> stock;
+    long long total_units = 0;
+    int retries = 0;
+};
+
+class InventoryStore {
+private:
+    static constexpr int MAX_OPTIMISTIC_ATTEMPTS = 64;
+
+    struct alignas(64) Stripe {
+        mutable std::mutex mtx;
+        std::atomic<unsigned long long> sequence{0};
+        std::atomic<long long> units{0};
+        std::vector<std::atomic<long long>> stock;
+    };
+
+    std::vector<Stripe> stripes;
+    int num_skus;
+
+public:
+    InventoryStore(int skus, int stripe_count = 16) : stripes(std::max(1, stripe_count)), num_skus(std::max(0, skus)) {
+        int n = (int)stripes.size();
+        for (int s = 0; s < n; ++s) stripes[s].stock = std::vector<std::atomic<long long>>((num_skus - s + n - 1) / n);
+    }
+
+    int getSkuCount() const { return num_skus; }
+    int getStripeCount() const { return (int)stripes.size(); }
+
+    bool restock(int sku, long long units) {
+        if (!validLine(sku, units)) return false;
+        Stripe& stripe = stripeOf(sku);
+        std::lock_guard<std::mutex> lock(stripe.mtx);
+        beginWrite(stripe);
+        apply(stripe, sku, units);
+        endWrite(stripe);
+        return true;
+    }
+
+    bool pick(int sku, long long units) {
+        if (!validLine(sku, units)) return false;
+        Stripe& stripe = stripeOf(sku);
+        std::lock_guard<std::mutex> lock(stripe.mtx);
+        if (slotOf(stripe, sku).load(std::memory_order_relaxed) < units) return false;
+        beginWrite(stripe);
+        apply(stripe, sku, -units);
+        endWrite(stripe);
+        return true;
+    }
+
+    bool pickOrder(const std::vector<InventoryLine>& lines) {
+        std::vector<int> touched;
+        for (const auto& line : lines) {
+            if (!validLine(line.sku, line.units)) return false;
+            touched.push_back(stripeIndex(line.sku));
+        }
+        std::sort(touched.begin(), touched.end());
+        touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+
+        std::vector<std::unique_lock<std::mutex>> locks;
+        for (int s : touched) locks.emplace_back(stripes[s].mtx);
+
+        for (size_t i = 0; i < lines.size(); ++i) {
+            long long wanted = 0;
+            for (const auto& line : lines) {
+                if (line.sku == lines[i].sku) wanted += line.units;
+            }
+            if (slotOf(stripeOf(lines[i].sku), lines[i].sku).load(std::memory_order_relaxed) < wanted) return false;
+        }
+        for (int s : touched) beginWrite(stripes[s]);
+        for (const auto& line : lines) apply(stripeOf(line.sku), line.sku, -line.units);
+        for (int s : touched) endWrite(stripes[s]);
+        return true;
+    }
+
+    long long getStock(int sku) const {
+        if (sku < 0 || sku >= num_skus) return 0;
+        return slotOf(stripeOf(sku), sku).load(std::memory_order_relaxed);
+    }
+
+    long long getTotalUnits() const {
+        long long total = 0;
+        readConsistent([this, &total]() {
+            total = 0;
+            for (const auto& stripe : stripes) total += stripe.units.load(std::memory_order_relaxed);
+        });
+        return total;
+    }
+
+    InventorySnapshot snapshot() const {
+        PROFILE_SCOPE("InventoryStore::snapshot");
+        InventorySnapshot result;
+        result.stock.resize(num_skus);
+        result.retries = readConsistent([this, &result]() {
+            result.total_units = 0;
+            int n = (int)stripes.size();
+            for (int s = 0; s < n; ++s) {
+                const Stripe& stripe = stripes[s];
+                for (size_t slot = 0; slot < stripe.stock.size(); ++slot) {
+                    result.stock[slot * n + s] = stripe.stock[slot].load(std::memory_order_relaxed);
+                }
+                result.total_units += stripe.units.load(std::memory_order_relaxed);
+            }
+        });
+        return result;
+    }
+
+private:
+    bool validLine(int sku, long long units) const { return sku >= 0 && sku < num_skus && units > 0; }
+
+    int stripeIndex(int sku) const { return sku % (int)stripes.size(); }
+    Stripe& stripeOf(int sku) { return stripes[stripeIndex(sku)]; }
+    const Stripe& stripeOf(int sku) const { return stripes[stripeIndex(sku)]; }
+
+    std::atomic<long long>& slotOf(Stripe& stripe, int sku) { return stripe.stock[sku / stripes.size()]; }
+    const std::atomic<long long>& slotOf(const Stripe& stripe, int sku) const {
+        return stripe.stock[sku / stripes.size()];
+    }
+
+    void apply(Stripe& stripe, int sku, long long delta) {
+        std::atomic<long long>& slot = slotOf(stripe, sku);
+        slot.store(slot.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+        stripe.units.store(stripe.units.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    static void beginWrite(Stripe& stripe) {
+        stripe.sequence.store(stripe.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    static void endWrite(Stripe& stripe) {
+        stripe.sequence.store(stripe.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    template <typename Copy>
+    int readConsistent(Copy copy) const {
+        for (int attempt = 0; attempt < MAX_OPTIMISTIC_ATTEMPTS; ++attempt) {
+            unsigned long long before = 0;
+            bool writing = false;
+            for (const auto& stripe : stripes) {
+                unsigned long long sequence = stripe.sequence.load(std::memory_order_acquire);
+                writing |= (sequence & 1) != 0;
+                before += sequence;
+            }
+            if (!writing) {
+                copy();
+                std::atomic_thread_fence(std::memory_order_acquire);
+                unsigned long long after = 0;
+                for (const auto& stripe : stripes) after += stripe.sequence.load(std::memory_order_relaxed);
+                if (after == before) return attempt;
+            }
+            std::this_thread::yield();
+        }
+        std::vector<std::unique_lock<std::mutex>> locks;
+        for (const auto& stripe : stripes) locks.emplace_back(stripe.mtx);
+        copy();
+        return MAX_OPTIMISTIC_ATTEMPTS;
+    }
+};
+
+#endif
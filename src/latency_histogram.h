@@ -0,0 +1,130 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <cmath>
+#include <climits>
+#include <algorithm>
+
+class LatencyHistogram {
+private:
+    static constexpr int SUB_BUCKET_BITS = 7;
+    static constexpr long long SUB_BUCKETS = 1LL << SUB_BUCKET_BITS;
+    static constexpr int BUCKETS = (64 - SUB_BUCKET_BITS) * SUB_BUCKETS;
+
+    struct BucketCount {
+        int bucket;
+        unsigned long long count;
+    };
+
+    std::vector<unsigned long long> counts;
+    unsigned long long total;
+    long long min_value;
+    long long max_value;
+    long double sum;
+
+public:
+    LatencyHistogram() : counts(BUCKETS, 0), total(0), min_value(LLONG_MAX), max_value(0), sum(0) {}
+
+    void reset() {
+        std::fill(counts.begin(), counts.end(), 0);
+        total = 0;
+        min_value = LLONG_MAX;
+        max_value = 0;
+        sum = 0;
+    }
+
+    void record(long long value, unsigned long long count = 1) {
+        if (value < 0) value = 0;
+        counts[bucketOf(value)] += count;
+        total += count;
+        min_value = std::min(min_value, value);
+        max_value = std::max(max_value, value);
+        sum += (long double)value * count;
+    }
+
+    void merge(const LatencyHistogram& other) {
+        if (other.total == 0) return;
+        for (int b = 0; b < BUCKETS; ++b) counts[b] += other.counts[b];
+        total += other.total;
+        min_value = std::min(min_value, other.min_value);
+        max_value = std::max(max_value, other.max_value);
+        sum += other.sum;
+    }
+
+    unsigned long long count() const { return total; }
+    long long min() const { return total ? min_value : 0; }
+    long long max() const { return max_value; }
+    double mean() const { return total ? (double)(sum / total) : 0; }
+
+    long long percentile(double fraction) const {
+        if (total == 0) return 0;
+        unsigned long long rank = (unsigned long long)std::ceil(fraction * total);
+        rank = std::max<unsigned long long>(1, std::min(rank, total));
+        unsigned long long seen = 0;
+        for (int b = 0; b < BUCKETS; ++b) {
+            seen += counts[b];
+            if (seen >= rank) return std::min(std::max(upperBoundOf(b), min_value), max_value);
+        }
+        return max_value;
+    }
+
+    template <typename Record>
+    void save(Record& record) const {
+        std::vector<BucketCount> used;
+        for (int b = 0; b < BUCKETS; ++b) {
+            if (counts[b]) used.push_back({b, counts[b]});
+        }
+        record.putVector(used);
+        record.put(total);
+        record.put(min_value);
+        record.put(max_value);
+        record.put(sum);
+    }
+
+    template <typename Record>
+    bool load(Record& record) {
+        std::vector<BucketCount> used;
+        if (!record.getVector(used)) return false;
+        reset();
+        for (const auto& entry : used) {
+            if (entry.bucket < 0 || entry.bucket >= BUCKETS) return false;
+            counts[entry.bucket] = entry.count;
+        }
+        return record.get(total) && record.get(min_value) && record.get(max_value) && record.get(sum);
+    }
+
+    static void printTable(std::ostream& out, const std::string& heading,
+                           const std::vector<std::pair<std::string, const LatencyHistogram*>>& rows) {
+        std::ostringstream table;
+        table << std::left << std::setw(16) << heading << std::right << std::setw(12) << "p50"
+              << std::setw(12) << "p90" << std::setw(12) << "p99" << std::setw(12) << "p99.9" << std::setw(12) << "max" << "\n";
+        for (const auto& row : rows) {
+            const LatencyHistogram& h = *row.second;
+            table << std::left << std::setw(16) << row.first << std::right << std::setw(12) << h.percentile(0.50)
+                  << std::setw(12) << h.percentile(0.90) << std::setw(12) << h.percentile(0.99)
+                  << std::setw(12) << h.percentile(0.999) << std::setw(12) << h.max() << "\n";
+        }
+        out << table.str();
+    }
+
+private:
+    static int bucketOf(long long value) {
+        if (value < 2 * SUB_BUCKETS) return (int)value;
+        int shift = (63 - __builtin_clzll((unsigned long long)value)) - SUB_BUCKET_BITS;
+        return (int)(shift * SUB_BUCKETS + (value >> shift));
+    }
+
+    static long long upperBoundOf(int bucket) {
+        if (bucket < 2 * SUB_BUCKETS) return bucket;
+        int shift = (int)(bucket / SUB_BUCKETS) - 1;
+        long long sub = bucket - shift * SUB_BUCKETS;
+        return (long long)(((unsigned long long)(sub + 1) << shift) - 1);
+    }
+};
+
+#endif
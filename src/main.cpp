@@ -1,9 +1,107 @@
 #include "warehouse_simulator.h"
+#include "order_stream.h"
+#include <map>
+#include <new>
 
-int main() {
+#ifdef WAREHOUSE_PROFILE
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+void* operator new(std::size_t size) {
+    Profiler::countAllocation(size);
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+#endif
+
+int printUsage() {
+    std::cerr << "Usage: warehouse_simulator [--verbosity off|summary|items] [--seed N] [--cache on|off] [--async-io on|off]\n"
+              << "           [--orders-csv <file>] [--trucks-csv <file>] [--order-columns field=column,...]\n"
+              << "           [--truck-columns field=column,...] [--import-threads N]\n"
+              << "       warehouse_simulator --render-timeline <file>\n"
+              << "       warehouse_simulator --stream <file|-> [--algorithm FCFS|SJF|SRJF|PRIORITY_NON_PREEMPTIVE|"
+              << "PRIORITY_PREEMPTIVE|RR] [--quantum N] [--stream-output <csv>]\n"
+              << "       warehouse_simulator --generate-orders <count> [--max-burst N] [--load 0.9] [--seed N]\n"
+              << "       warehouse_simulator --replicate <count> [--orders N] [--seed N] [--threads N] [--quantum N]" << std::endl;
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
     try {
+        std::map<std::string, std::string> options;
+        for (int i = 1; i < argc; i += 2) {
+            std::string flag = argv[i];
+            if (flag.rfind("--", 0) != 0 || i + 1 >= argc) return printUsage();
+            options[flag] = argv[i + 1];
+        }
+        auto option = [&options](const std::string& flag, const std::string& fallback) {
+            auto it = options.find(flag);
+            return it == options.end() ? fallback : it->second;
+        };
+
+        if (options.count("--verbosity")) {
+            Verbosity level;
+            if (!ConsoleUI::parseVerbosity(options["--verbosity"], level)) {
+                std::cerr << "Unknown verbosity " << options["--verbosity"] << " (expected off, summary or items)" << std::endl;
+                return 1;
+            }
+            ConsoleUI::setVerbosity(level);
+        }
+
+        if (option("--async-io", "on") != "on") AsyncWriter::instance().setAsynchronous(false);
+
+        if (options.count("--render-timeline")) {
+            return ExecutionTimeline::renderBinaryFile(options["--render-timeline"], std::cout) ? 0 : 1;
+        }
+
+        if (options.count("--generate-orders")) {
+            StreamingIngest::generateOrders(std::cout, std::stoll(options["--generate-orders"]),
+                                            std::stoi(option("--max-burst", "20")), 10,
+                                            std::stod(option("--load", "0.9")), (unsigned)std::stoul(option("--seed", "42")));
+            return 0;
+        }
+
+        if (options.count("--stream")) {
+            CPUAlgorithm algorithm;
+            if (!parseAlgorithmName(option("--algorithm", "FCFS"), algorithm)) return printUsage();
+            StreamingIngest ingest(algorithm, std::stoi(option("--quantum", "4")));
+            FileManager::createDirectoryIfNeeded("output");
+            std::string output = option("--stream-output", "output/stream_results.csv");
+            if (options["--stream"] == "-") return ingest.run(std::cin, output) ? 0 : 1;
+            std::ifstream input(options["--stream"], std::ios::binary);
+            if (!input.is_open()) {
+                std::cerr << "❌ Error: Could not open file " << options["--stream"] << std::endl;
+                return 1;
+            }
+            return ingest.run(input, output) ? 0 : 1;
+        }
+
+        if (options.count("--replicate")) {
+            ReplicationConfig config;
+            config.generator = ReplicationStudy::defaultConfig(std::stoi(option("--orders", "200")));
+            config.replications = std::stoi(options["--replicate"]);
+            config.base_seed = (unsigned)std::stoul(option("--seed", "42"));
+            config.num_threads = std::stoi(option("--threads", std::to_string(std::max(1u, std::thread::hardware_concurrency()))));
+            config.time_quantum = std::stoi(option("--quantum", "4"));
+            config.context_switch_cost = 0;
+            FileManager::createDirectoryIfNeeded("output");
+            ReplicationStudy study(config);
+            study.runAndReport();
+            return FileManager::flushWrites() ? 0 : 1;
+        }
+
         WarehouseSimulator simulator;
+        if (options.count("--seed")) simulator.setSeed((unsigned)std::stoul(options["--seed"]));
+        if (option("--cache", "on") != "on") simulator.setCacheEnabled(false);
+        if (options.count("--orders-csv") || options.count("--trucks-csv")) {
+            TraceImportOptions import{option("--orders-csv", ""), option("--trucks-csv", ""), option("--order-columns", ""),
+                                      option("--truck-columns", ""), std::stoi(option("--import-threads", "0"))};
+            if (!simulator.importTraces(import)) return 1;
+        }
         simulator.run();
+        if (!FileManager::flushWrites()) return 1;
     } catch (const std::exception& e) {
         std::cerr << "Fatal Error: " << e.what() << std::endl;
         return 1;
@@ -2,146 +2,248 @@
 #define MEMORY_MANAGER_H
 
 #include "utilities.h"
+#include "scheduling_policies.h"
+#include "scratch_arena.h"
+#include "result_cache.h"
+#include "rack_compaction.h"
 #include <algorithm>
+#include <unordered_map>
+#include <memory>
+#include <random>
 
 class MemoryManager {
 private:
     std::vector<MemoryBlock> blocks;
-    std::vector<Process> processes;
+    std::shared_ptr<const std::vector<Process>> shared_processes;
+    const std::vector<Process>& processes;
     int warehouse_size;
     int max_process_size;
     int next_fit_index;
+    ResultCache* result_cache;
+    uint64_t dataset_hash;
 
 public:
-    MemoryManager(const std::vector<MemoryBlock>& mem_blocks, const std::vector<Process>& procs, int size, int max_size)
-        : blocks(mem_blocks), processes(procs), warehouse_size(size), max_process_size(max_size), next_fit_index(0) {}
+    explicit MemoryManager(const std::vector<MemoryBlock>& mem_blocks, std::shared_ptr<const std::vector<Process>> procs, int size, int max_size)
+        : blocks(mem_blocks), shared_processes(std::move(procs)), processes(*shared_processes), warehouse_size(size),
+          max_process_size(max_size), next_fit_index(0), result_cache(nullptr), dataset_hash(0) {}
+
+    explicit MemoryManager(const std::vector<MemoryBlock>& mem_blocks, const std::vector<Process>& procs, int size, int max_size)
+        : MemoryManager(mem_blocks, std::make_shared<const std::vector<Process>>(procs), size, max_size) {}
+
+    void setResultCache(ResultCache* cache, uint64_t hash) {
+        result_cache = cache;
+        dataset_hash = hash;
+    }
 
     void runFirstFit() {
         ConsoleUI::printSection("First Fit Allocation - Place in First Available Rack");
-        allocateFirstFit();
+        allocateCached(FitStrategy::FIRST_FIT);
         displayAllocation("First Fit");
     }
 
     void runBestFit() {
         ConsoleUI::printSection("Best Fit Allocation - Find Tightest Fitting Rack");
-        allocateBestFit();
+        allocateCached(FitStrategy::BEST_FIT);
         displayAllocation("Best Fit");
     }
 
     void runNextFit() {
         ConsoleUI::printSection("Next Fit Allocation - Continuous Allocation from Last Position");
-        allocateNextFit();
+        allocateCached(FitStrategy::NEXT_FIT);
         displayAllocation("Next Fit");
     }
 
     void runWorstFit() {
         ConsoleUI::printSection("Worst Fit Allocation - Place in Largest Available Rack");
-        allocateWorstFit();
+        allocateCached(FitStrategy::WORST_FIT);
         displayAllocation("Worst Fit");
     }
 
-private:
-    void allocateFirstFit() {
-        for (const auto& process : processes) {
-            bool allocated = false;
-            for (auto& block : blocks) {
-                if (!block.is_allocated && block.size >= process.burst_time) {
-                    block.is_allocated = true;
-                    block.process_id = process.id;
-                    allocated = true;
-                    break;
-                }
-            }
+    void allocate(FitStrategy strategy) {
+        switch (strategy) {
+            case FitStrategy::FIRST_FIT: allocateFirstFit(); break;
+            case FitStrategy::BEST_FIT: allocateBestFit(); break;
+            case FitStrategy::NEXT_FIT: allocateNextFit(); break;
+            case FitStrategy::WORST_FIT: allocateWorstFit(); break;
         }
     }
 
-    void allocateBestFit() {
-        for (const auto& process : processes) {
-            int best_block = -1;
-            int min_wasted_space = INT_MAX;
-
-            for (size_t i = 0; i < blocks.size(); ++i) {
-                if (!blocks[i].is_allocated && blocks[i].size >= process.burst_time) {
-                    int wasted = blocks[i].size - process.burst_time;
-                    if (wasted < min_wasted_space) {
-                        min_wasted_space = wasted;
-                        best_block = i;
-                    }
-                }
+    int getAllocatedCount() const {
+        int count = 0;
+        for (const auto& block : blocks) {
+            if (block.is_allocated) count++;
+        }
+        return count;
+    }
+
+    const std::vector<MemoryBlock>& getBlocks() const { return blocks; }
+
+    int releaseShipped(int percent, unsigned seed) {
+        std::mt19937 gen(seed + 4);
+        std::bernoulli_distribution shipped(percent / 100.0);
+        int released = 0;
+        for (auto& block : blocks) {
+            if (block.is_allocated && shipped(gen)) {
+                block.is_allocated = false;
+                block.process_id = -1;
+                released++;
             }
+        }
+        return released;
+    }
+
+    CompactionPlan planCompaction(int max_moves = -1) const {
+        return RackCompactionPlanner(blocks, processes).plan(max_moves);
+    }
 
-            if (best_block != -1) {
-                blocks[best_block].is_allocated = true;
-                blocks[best_block].process_id = process.id;
+    void applyCompaction(const CompactionPlan& plan) {
+        if (plan.empty()) return;
+        for (const auto& move : plan.moves) {
+            blocks[move.to_rack].is_allocated = true;
+            blocks[move.to_rack].process_id = move.process_id;
+            blocks[move.from_rack].is_allocated = false;
+            blocks[move.from_rack].process_id = -1;
+        }
+        int merged = plan.last_rack - plan.first_rack;
+        for (int i = plan.first_rack + 1; i <= plan.last_rack; ++i) blocks[plan.first_rack].size += blocks[i].size;
+        blocks.erase(blocks.begin() + plan.first_rack + 1, blocks.begin() + plan.last_rack + 1);
+        if (next_fit_index > plan.last_rack) next_fit_index -= merged;
+        else if (next_fit_index > plan.first_rack) next_fit_index = plan.first_rack;
+    }
+
+    void runCompactionPlanner(int max_moves) {
+        ConsoleUI::printSection(max_moves < 0 ? std::string("Rack Compaction - Largest Contiguous Space")
+                                              : "Rack Compaction - At Most " + std::to_string(max_moves) + " Moves");
+        CompactionPlan plan = planCompaction(max_moves);
+        std::vector<std::vector<std::string>> csv = {{"Order_ID", "Units", "From_Rack", "To_Rack"}};
+        std::ostringstream table;
+        if (ConsoleUI::showItems()) {
+            table << std::left << std::setw(12) << "Order_ID" << std::setw(12) << "Units" << std::setw(12) << "From_Rack"
+                  << std::setw(12) << "To_Rack" << "\n" << std::string(48, '-') << "\n";
+        }
+        for (const auto& move : plan.moves) {
+            std::string from = "B" + std::to_string(blocks[move.from_rack].block_id);
+            std::string to = "B" + std::to_string(blocks[move.to_rack].block_id);
+            csv.push_back({"P" + std::to_string(move.process_id), std::to_string(move.units), from, to});
+            if (ConsoleUI::showItems()) {
+                table << std::setw(12) << "P" + std::to_string(move.process_id) << std::setw(12) << move.units
+                      << std::setw(12) << from << std::setw(12) << to << "\n";
             }
         }
+        FileManager::writeToCSV("output/rack_compaction_plan.csv", csv);
+        if (plan.empty()) {
+            ConsoleUI::printWarning("No rack can be emptied");
+            return;
+        }
+
+        std::string first = "B" + std::to_string(blocks[plan.first_rack].block_id);
+        std::string last = "B" + std::to_string(blocks[plan.last_rack].block_id);
+        applyCompaction(plan);
+        if (!ConsoleUI::showSummary()) return;
+
+        std::cout << table.str();
+        std::cout << "\n" << std::string(48, '-') << "\n";
+        std::cout << "COMPACTION PLAN:\n";
+        std::cout << "Racks Emptied: " << first << " .. " << last << " (merged into " << first << ")\n";
+        std::cout << "Moves: " << plan.moves.size() << "\n";
+        std::cout << "Largest Contiguous Free Space: " << plan.largest_free_before << " -> "
+                  << RackCompactionPlanner::largestFreeRun(blocks) << " units\n";
+        std::cout << std::fixed << std::setprecision(3) << "Planning Time: " << plan.planning_ms << " ms for "
+                  << blocks.size() << " racks\n";
     }
 
-    void allocateNextFit() {
-        for (const auto& process : processes) {
-            for (size_t i = 0; i < blocks.size(); ++i) {
-                int index = (next_fit_index + i) % blocks.size();
-                if (!blocks[index].is_allocated && blocks[index].size >= process.burst_time) {
-                    blocks[index].is_allocated = true;
-                    blocks[index].process_id = process.id;
-                    next_fit_index = (index + 1) % blocks.size();
-                    break;
-                }
+private:
+    void allocateCached(FitStrategy strategy) {
+        CacheKey key = CacheKey().add((long long)dataset_hash).add("rack").add((int)strategy);
+        CacheRecord record;
+        if (result_cache && result_cache->load(key, record)) {
+            std::vector<MemoryBlock> cached;
+            int cached_next_fit = 0;
+            if (record.getVector(cached) && record.get(cached_next_fit) && record.good() && cached.size() == blocks.size()) {
+                blocks = std::move(cached);
+                next_fit_index = cached_next_fit;
+                return;
             }
         }
+        allocate(strategy);
+        if (!result_cache) return;
+        CacheRecord saved;
+        saved.putVector(blocks);
+        saved.put(next_fit_index);
+        result_cache->store(key, saved);
+    }
+
+    void allocateFirstFit() {
+        PROFILE_SCOPE("MemoryManager::allocateFirstFit");
+        allocateWith(FitStrategy::FIRST_FIT);
+    }
+
+    void allocateBestFit() {
+        PROFILE_SCOPE("MemoryManager::allocateBestFit");
+        allocateWith(FitStrategy::BEST_FIT);
+    }
+
+    void allocateNextFit() {
+        PROFILE_SCOPE("MemoryManager::allocateNextFit");
+        allocateWith(FitStrategy::NEXT_FIT);
     }
 
     void allocateWorstFit() {
-        for (const auto& process : processes) {
-            int worst_block = -1;
-            int max_size = -1;
-
-            for (size_t i = 0; i < blocks.size(); ++i) {
-                if (!blocks[i].is_allocated && blocks[i].size >= process.burst_time) {
-                    if (blocks[i].size > max_size) {
-                        max_size = blocks[i].size;
-                        worst_block = i;
-                    }
-                }
-            }
+        PROFILE_SCOPE("MemoryManager::allocateWorstFit");
+        allocateWith(FitStrategy::WORST_FIT);
+    }
 
-            if (worst_block != -1) {
-                blocks[worst_block].is_allocated = true;
-                blocks[worst_block].process_id = process.id;
+    void allocateWith(FitStrategy strategy) {
+        ScratchArena::Scope scratch;
+        ScratchVector<int> free_size(blocks.size(), &ScratchArena::local());
+        for (size_t i = 0; i < blocks.size(); ++i) free_size[i] = blocks[i].is_allocated ? INT_MIN : blocks[i].size;
+
+        for (const auto& process : processes) {
+            int chosen = RackFit::choose(strategy, free_size.data(), (int)free_size.size(), process.size, next_fit_index);
+            if (chosen != -1) {
+                blocks[chosen].is_allocated = true;
+                blocks[chosen].process_id = process.id;
+                free_size[chosen] = INT_MIN;
             }
         }
     }
 
     void displayAllocation(const std::string& algorithm) {
+        PROFILE_SCOPE("MemoryManager::displayAllocation");
+        if (!ConsoleUI::showSummary()) return;
         ConsoleUI::printSection("STORAGE ALLOCATION RESULTS - " + algorithm);
 
         int total_allocated = 0;
         int total_used = 0;
         int allocated_count = 0;
+        bool show_items = ConsoleUI::showItems();
 
-        std::cout << std::left << std::setw(12) << "Order_ID" << std::setw(12) << "Order_Size" << std::setw(12) << "Rack_Number" << "\n";
-        std::cout << std::string(36, '-') << "\n";
+        std::unordered_map<int, const MemoryBlock*> rack_of;
+        rack_of.reserve(blocks.size());
+        for (const auto& block : blocks) {
+            if (block.is_allocated) rack_of.emplace(block.process_id, &block);
+        }
+
+        std::ostringstream table;
+        if (show_items) {
+            table << std::left << std::setw(12) << "Order_ID" << std::setw(12) << "Order_Size" << std::setw(12) << "Rack_Number" << "\n";
+            table << std::string(36, '-') << "\n";
+        }
 
         for (const auto& process : processes) {
-            bool found = false;
-            for (const auto& block : blocks) {
-                if (block.process_id == process.id) {
-                    std::cout << std::left << std::setw(12) << "P" + std::to_string(process.id)
-                              << std::setw(12) << process.burst_time
-                              << std::setw(12) << "B" + std::to_string(block.block_id) << "\n";
-                    total_allocated += block.size;
-                    total_used += process.burst_time;
-                    allocated_count++;
-                    found = true;
-                    break;
-                }
+            auto rack = rack_of.find(process.id);
+            if (rack != rack_of.end()) {
+                total_allocated += rack->second->size;
+                total_used += process.size;
+                allocated_count++;
             }
-            if (!found) {
-                std::cout << std::left << std::setw(12) << "P" + std::to_string(process.id)
-                          << std::setw(12) << process.burst_time
-                          << std::setw(12) << "Not Allocated" << "\n";
+            if (show_items) {
+                table << std::left << std::setw(12) << "P" + std::to_string(process.id)
+                      << std::setw(12) << process.size
+                      << std::setw(12) << (rack != rack_of.end() ? "B" + std::to_string(rack->second->block_id) : "Not Allocated") << "\n";
             }
         }
+        std::cout << table.str();
 
         std::cout << "\n" << std::string(36, '-') << "\n";
         std::cout << "ALLOCATION STATISTICS:\n";
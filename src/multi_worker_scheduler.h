@@ -0,0 +1,481 @@
+#ifndef MULTI_WORKER_SCHEDULER_H
+#define MULTI_WORKER_SCHEDULER_H
+
+#include "utilities.h"
+#include "latency_histogram.h"
+#include <queue>
+#include <set>
+#include <random>
+#include <functional>
+
+enum class QueueMode {
+    GLOBAL,
+    PER_WORKER
+};
+
+struct MultiWorkerConfig {
+    CPUAlgorithm algorithm;
+    int num_workers;
+    QueueMode queue_mode;
+    bool load_balancing;
+    int time_quantum;
+};
+
+struct WorkerSummary {
+    int worker_id;
+    long long busy_time;
+    int orders_completed;
+    int preemptions;
+    int migrations_in;
+};
+
+class MultiWorkerSimulator {
+private:
+    struct ReadyEntry {
+        long long primary;
+        long long secondary;
+        int index;
+
+        bool operator>(const ReadyEntry& other) const {
+            if (primary != other.primary) return primary > other.primary;
+            if (secondary != other.secondary) return secondary > other.secondary;
+            return index > other.index;
+        }
+    };
+
+    struct WorkerEvent {
+        long long time;
+        int worker;
+        long long version;
+
+        bool operator>(const WorkerEvent& other) const {
+            if (time != other.time) return time > other.time;
+            return worker > other.worker;
+        }
+    };
+
+    struct WorkerState {
+        int current;
+        long long slice_start;
+        long long slice_end;
+        long long version;
+        int queue_length;
+        bool is_idle;
+    };
+
+    using ReadyQueue = std::priority_queue<ReadyEntry, std::vector<ReadyEntry>, std::greater<ReadyEntry>>;
+
+    std::vector<Process> orders;
+    MultiWorkerConfig config;
+    std::vector<long long> remaining;
+    std::vector<long long> first_start;
+    std::vector<int> last_worker;
+    std::vector<WorkerState> workers;
+    std::vector<WorkerSummary> summaries;
+    std::vector<ReadyQueue> queues;
+    std::priority_queue<WorkerEvent, std::vector<WorkerEvent>, std::greater<WorkerEvent>> events;
+    std::set<std::pair<long long, int>> running;
+    std::vector<int> idle_stack;
+    std::vector<int> freed;
+    std::vector<int> expired;
+    std::vector<int> woken;
+    std::vector<int> touched;
+    long long rr_sequence;
+    long long total_queued;
+    long long makespan;
+    int total_migrations;
+    std::mt19937 gen;
+
+public:
+    MultiWorkerSimulator(const std::vector<Process>& procs, const MultiWorkerConfig& cfg)
+        : orders(procs), config(cfg), rr_sequence(0), total_queued(0), makespan(0), total_migrations(0), gen(12345) {
+        if (config.num_workers < 1) config.num_workers = 1;
+        if (config.time_quantum < 1) config.time_quantum = 1;
+    }
+
+    void run() {
+        PROFILE_SCOPE("MultiWorkerSimulator::run");
+        std::stable_sort(orders.begin(), orders.end(),
+                        [](const Process& a, const Process& b) { return a.arrival_time < b.arrival_time; });
+
+        int n = (int)orders.size();
+        int m = config.num_workers;
+        remaining.assign(n, 0);
+        first_start.assign(n, -1);
+        last_worker.assign(n, 0);
+        for (int i = 0; i < n; ++i) remaining[i] = orders[i].burst_time;
+
+        workers.assign(m, WorkerState{-1, 0, 0, 0, 0, true});
+        summaries.assign(m, WorkerSummary{0, 0, 0, 0, 0});
+        queues.assign(config.queue_mode == QueueMode::GLOBAL ? 1 : m, ReadyQueue());
+        events = decltype(events)();
+        running.clear();
+        idle_stack.clear();
+        for (int w = m - 1; w >= 0; --w) {
+            summaries[w].worker_id = w + 1;
+            idle_stack.push_back(w);
+        }
+        rr_sequence = 0;
+        total_queued = 0;
+        makespan = 0;
+        total_migrations = 0;
+
+        int next = 0;
+        int finished = 0;
+        const long long never = LLONG_MAX;
+
+        while (finished < n) {
+            while (!events.empty() && events.top().version != workers[events.top().worker].version) {
+                events.pop();
+                PROFILE_COUNT(HEAP_OPERATIONS, 1);
+            }
+            long long next_event = events.empty() ? never : events.top().time;
+            long long next_arrival = next < n ? orders[next].arrival_time : never;
+            long long now = std::min(next_event, next_arrival);
+
+            freed.clear();
+            expired.clear();
+            woken.clear();
+            touched.clear();
+
+            while (!events.empty() && events.top().time == now) {
+                WorkerEvent ev = events.top();
+                events.pop();
+                PROFILE_COUNT(HEAP_OPERATIONS, 1);
+                if (ev.version != workers[ev.worker].version) continue;
+                int i = stop(ev.worker, now);
+                if (remaining[i] == 0) {
+                    finish(i, ev.worker, now);
+                    finished++;
+                } else {
+                    expired.push_back(i);
+                }
+                freed.push_back(ev.worker);
+            }
+
+            while (next < n && orders[next].arrival_time <= now) {
+                admit(next++);
+            }
+
+            for (int i : expired) {
+                enqueue(i, config.queue_mode == QueueMode::GLOBAL ? 0 : last_worker[i] - 1);
+            }
+
+            for (int w : freed) dispatch(w, now);
+            fillIdle(now);
+            if (isPreemptive()) preemptionPass(now);
+        }
+    }
+
+    const std::vector<Process>& getCompleted() const { return orders; }
+    const std::vector<WorkerSummary>& getWorkerSummaries() const { return summaries; }
+    long long getMakespan() const { return makespan; }
+    int getTotalMigrations() const { return total_migrations; }
+
+    int getTotalPreemptions() const {
+        int total = 0;
+        for (const auto& s : summaries) total += s.preemptions;
+        return total;
+    }
+
+    std::string describe() const {
+        std::string mode = config.queue_mode == QueueMode::GLOBAL ? "global queue" : "per-worker queues";
+        if (config.queue_mode == QueueMode::PER_WORKER && config.load_balancing) mode += " + balancing";
+        std::string name = algorithmName(config.algorithm);
+        if (config.algorithm == CPUAlgorithm::ROUND_ROBIN) name += " (TQ=" + std::to_string(config.time_quantum) + ")";
+        return name + ", " + std::to_string(config.num_workers) + " workers, " + mode;
+    }
+
+    void displayResults() const {
+        PROFILE_SCOPE("MultiWorkerSimulator::displayResults");
+        if (!ConsoleUI::showSummary()) return;
+        size_t n = orders.size();
+        LatencyHistogram waiting, turnaround, response;
+        for (size_t i = 0; i < n; ++i) {
+            waiting.record(orders[i].waiting_time);
+            turnaround.record(orders[i].turnaround_time);
+            response.record(first_start[i] - orders[i].arrival_time);
+        }
+
+        ConsoleUI::printSection("MULTI-WORKER RESULTS - " + describe());
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "Makespan: " << makespan << " units\n";
+        std::cout << "Throughput: " << (makespan > 0 ? n * 1.0 / makespan : 0) << " orders/unit\n";
+        std::cout << "Avg Waiting Time: " << waiting.mean() << " units\n";
+        std::cout << "Avg Turnaround Time: " << turnaround.mean() << " units\n";
+        std::cout << "Avg Response Time: " << response.mean() << " units\n";
+        std::cout << "Preemptions: " << getTotalPreemptions() << " | Migrations: " << total_migrations << "\n\n";
+        LatencyHistogram::printTable(std::cout, "Latency (units)", {{"Waiting", &waiting}, {"Turnaround", &turnaround}, {"Response", &response}});
+
+        double min_util = 100.0, max_util = 0, sum_util = 0;
+        for (const auto& s : summaries) {
+            double util = utilization(s);
+            min_util = std::min(min_util, util);
+            max_util = std::max(max_util, util);
+            sum_util += util;
+        }
+        std::cout << "\nWorker Utilization: avg " << sum_util / summaries.size() << "% | min " << min_util
+                  << "% | max " << max_util << "%\n";
+
+        if (ConsoleUI::showItems() && summaries.size() <= 32) {
+            std::ostringstream table;
+            table << std::fixed << std::setprecision(2);
+            table << std::left << std::setw(10) << "Worker" << std::setw(10) << "Orders" << std::setw(12) << "Busy"
+                  << std::setw(14) << "Preemptions" << std::setw(12) << "Migrated" << "Utilization\n";
+            table << std::string(70, '-') << "\n";
+            for (const auto& s : summaries) {
+                table << std::left << std::setw(10) << "W" + std::to_string(s.worker_id)
+                      << std::setw(10) << s.orders_completed << std::setw(12) << s.busy_time
+                      << std::setw(14) << s.preemptions << std::setw(12) << s.migrations_in
+                      << utilization(s) << "%\n";
+            }
+            std::cout << table.str();
+        }
+    }
+
+    void saveToCSV(const std::string& filename) const {
+        std::vector<std::vector<std::string>> csv_data;
+        csv_data.push_back({"Order_ID", "Arrival_Time", "Burst_Time", "Priority", "Worker", "Completion_Time", "Waiting_Time", "Turnaround_Time"});
+
+        for (size_t i = 0; i < orders.size(); ++i) {
+            const Process& p = orders[i];
+            csv_data.push_back({
+                std::to_string(p.id),
+                std::to_string(p.arrival_time),
+                std::to_string(p.burst_time),
+                std::to_string(p.priority),
+                "W" + std::to_string(last_worker[i]),
+                std::to_string(p.completion_time),
+                std::to_string(p.waiting_time),
+                std::to_string(p.turnaround_time)
+            });
+        }
+
+        csv_data.push_back({""});
+        csv_data.push_back({"Worker", "Orders", "Busy_Time", "Preemptions", "Migrations_In", "Utilization"});
+        for (const auto& s : summaries) {
+            csv_data.push_back({
+                "W" + std::to_string(s.worker_id),
+                std::to_string(s.orders_completed),
+                std::to_string(s.busy_time),
+                std::to_string(s.preemptions),
+                std::to_string(s.migrations_in),
+                std::to_string(utilization(s))
+            });
+        }
+        csv_data.push_back({"Makespan", std::to_string(makespan)});
+
+        FileManager::writeToCSV(filename, csv_data);
+    }
+
+private:
+    bool isPreemptive() const {
+        return config.algorithm == CPUAlgorithm::SRJF || config.algorithm == CPUAlgorithm::PRIORITY_PREEMPTIVE;
+    }
+
+    double utilization(const WorkerSummary& s) const {
+        return makespan > 0 ? s.busy_time * 100.0 / makespan : 0;
+    }
+
+    ReadyEntry makeEntry(int i) {
+        const Process& p = orders[i];
+        switch (config.algorithm) {
+            case CPUAlgorithm::SJF: return {p.burst_time, p.arrival_time, i};
+            case CPUAlgorithm::SRJF: return {remaining[i], p.arrival_time, i};
+            case CPUAlgorithm::PRIORITY_NON_PREEMPTIVE:
+            case CPUAlgorithm::PRIORITY_PREEMPTIVE: return {-(long long)p.priority, p.arrival_time, i};
+            case CPUAlgorithm::ROUND_ROBIN: return {rr_sequence++, 0, i};
+            case CPUAlgorithm::FCFS:
+            default: return {p.arrival_time, 0, i};
+        }
+    }
+
+    long long runningKey(int w) const {
+        if (config.algorithm == CPUAlgorithm::SRJF) return workers[w].slice_end;
+        return -(long long)orders[workers[w].current].priority;
+    }
+
+    bool beats(const ReadyEntry& candidate, long long running_key, long long now) const {
+        if (config.algorithm == CPUAlgorithm::SRJF) return candidate.primary < running_key - now;
+        return candidate.primary < running_key;
+    }
+
+    void enqueue(int i, int q) {
+        queues[q].push(makeEntry(i));
+        PROFILE_COUNT(HEAP_OPERATIONS, 1);
+        total_queued++;
+        if (config.queue_mode == QueueMode::PER_WORKER) {
+            workers[q].queue_length++;
+            if (workers[q].is_idle) woken.push_back(q);
+        }
+    }
+
+    int popFrom(int q) {
+        int i = queues[q].top().index;
+        queues[q].pop();
+        PROFILE_COUNT(HEAP_OPERATIONS, 1);
+        total_queued--;
+        if (config.queue_mode == QueueMode::PER_WORKER) workers[q].queue_length--;
+        return i;
+    }
+
+    int popIdle() {
+        while (!idle_stack.empty()) {
+            int w = idle_stack.back();
+            idle_stack.pop_back();
+            if (workers[w].is_idle) return w;
+        }
+        return -1;
+    }
+
+    int chooseWorker() {
+        int m = config.num_workers;
+        if (config.load_balancing) {
+            int w = popIdle();
+            while (w != -1 && workers[w].queue_length > 0) w = popIdle();
+            if (w != -1) return w;
+        }
+        if (m == 1) return 0;
+        std::uniform_int_distribution<> dist(0, m - 1);
+        int a = dist(gen);
+        int b = dist(gen);
+        int load_a = workers[a].queue_length + (workers[a].current != -1);
+        int load_b = workers[b].queue_length + (workers[b].current != -1);
+        return load_b < load_a ? b : a;
+    }
+
+    void admit(int i) {
+        if (config.queue_mode == QueueMode::GLOBAL) {
+            enqueue(i, 0);
+        } else {
+            int w = chooseWorker();
+            enqueue(i, w);
+            touched.push_back(w);
+        }
+    }
+
+    int steal(int w) {
+        if (total_queued == 0) return -1;
+        int victim = -1;
+        int longest = 0;
+        for (int v = 0; v < config.num_workers; ++v) {
+            if (v != w && workers[v].queue_length > longest) {
+                longest = workers[v].queue_length;
+                victim = v;
+            }
+        }
+        if (victim == -1) return -1;
+        total_migrations++;
+        summaries[w].migrations_in++;
+        return popFrom(victim);
+    }
+
+    void start(int w, int i, long long now) {
+        WorkerState& ws = workers[w];
+        ws.current = i;
+        ws.is_idle = false;
+        ws.slice_start = now;
+        long long length = remaining[i];
+        if (config.algorithm == CPUAlgorithm::ROUND_ROBIN) length = std::min<long long>(config.time_quantum, length);
+        ws.slice_end = now + length;
+        ws.version++;
+        if (first_start[i] < 0) first_start[i] = now;
+        last_worker[i] = w + 1;
+        events.push({ws.slice_end, w, ws.version});
+        PROFILE_COUNT(HEAP_OPERATIONS, 1);
+        if (isPreemptive() && config.queue_mode == QueueMode::GLOBAL) running.insert({runningKey(w), w});
+    }
+
+    int stop(int w, long long now) {
+        WorkerState& ws = workers[w];
+        int i = ws.current;
+        if (isPreemptive() && config.queue_mode == QueueMode::GLOBAL) running.erase({runningKey(w), w});
+        long long ran = now - ws.slice_start;
+        remaining[i] -= ran;
+        summaries[w].busy_time += ran;
+        ws.current = -1;
+        ws.version++;
+        return i;
+    }
+
+    void finish(int i, int w, long long now) {
+        Process& p = orders[i];
+        p.completion_time = (int)now;
+        p.turnaround_time = p.completion_time - p.arrival_time;
+        p.waiting_time = p.turnaround_time - p.burst_time;
+        summaries[w].orders_completed++;
+        makespan = std::max(makespan, now);
+    }
+
+    void markIdle(int w) {
+        workers[w].is_idle = true;
+        idle_stack.push_back(w);
+    }
+
+    void dispatch(int w, long long now) {
+        int q = config.queue_mode == QueueMode::GLOBAL ? 0 : w;
+        int i = -1;
+        if (!queues[q].empty()) {
+            i = popFrom(q);
+        } else if (config.queue_mode == QueueMode::PER_WORKER && config.load_balancing) {
+            i = steal(w);
+        }
+        if (i == -1) {
+            markIdle(w);
+        } else {
+            start(w, i, now);
+        }
+    }
+
+    void fillIdle(long long now) {
+        if (config.queue_mode == QueueMode::GLOBAL) {
+            while (!queues[0].empty()) {
+                int w = popIdle();
+                if (w == -1) break;
+                start(w, popFrom(0), now);
+            }
+            return;
+        }
+        for (int w : woken) {
+            if (workers[w].is_idle && !queues[w].empty()) start(w, popFrom(w), now);
+        }
+        if (!config.load_balancing) return;
+        while (total_queued > 0) {
+            int w = popIdle();
+            if (w == -1) break;
+            int i = steal(w);
+            if (i == -1) {
+                markIdle(w);
+                break;
+            }
+            start(w, i, now);
+        }
+    }
+
+    void preemptionPass(long long now) {
+        if (config.queue_mode == QueueMode::GLOBAL) {
+            while (!queues[0].empty() && !running.empty()) {
+                auto worst = *running.rbegin();
+                if (!beats(queues[0].top(), worst.first, now)) break;
+                int w = worst.second;
+                int next = popFrom(0);
+                int preempted = stop(w, now);
+                summaries[w].preemptions++;
+                start(w, next, now);
+                enqueue(preempted, 0);
+            }
+            return;
+        }
+        for (int w : touched) {
+            if (workers[w].current == -1 || queues[w].empty()) continue;
+            if (!beats(queues[w].top(), runningKey(w), now)) continue;
+            int next = popFrom(w);
+            int preempted = stop(w, now);
+            summaries[w].preemptions++;
+            start(w, next, now);
+            enqueue(preempted, w);
+        }
+    }
+};
+
+#endif
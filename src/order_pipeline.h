@@ -0,0 +1,584 @@
+#ifndef ORDER_PIPELINE_H
+#define ORDER_PIPELINE_H
+
+#include "utilities.h"
+#include "data_generator.h"
+#include "memory_manager.h"
+#include "disk_scheduler.h"
+#include "latency_histogram.h"
+#include "scheduling_policies.h"
+#include <queue>
+#include <deque>
+
+struct PipelineConfig {
+    CPUAlgorithm pick_algorithm;
+    int num_pickers;
+    FitStrategy rack_strategy;
+    DiskAlgorithm truck_algorithm;
+    int num_trucks;
+    int staging_capacity;
+    int restock_interval;
+    int restock_batch;
+    int load_time;
+    int cylinders_per_unit;
+};
+
+enum class PipelineStage {
+    STOCK,
+    PICKING,
+    RACKING,
+    TRUCKING
+};
+
+class OrderPipeline {
+private:
+    enum class EventType {
+        TRUCK_DONE,
+        PICK_DONE,
+        RESTOCK
+    };
+
+    struct Event {
+        long long time;
+        EventType type;
+        int target;
+
+        bool operator>(const Event& other) const {
+            if (time != other.time) return time > other.time;
+            if (type != other.type) return type > other.type;
+            return target > other.target;
+        }
+    };
+
+    struct PickEntry {
+        long long key;
+        int index;
+
+        bool operator>(const PickEntry& other) const {
+            if (key != other.key) return key > other.key;
+            return index > other.index;
+        }
+    };
+
+    struct OrderRecord {
+        int id;
+        int arrival;
+        int duration;
+        int size;
+        int priority;
+        int cylinder;
+        long long pick_start;
+        long long picked;
+        long long racked;
+        long long dispatched;
+        int rack;
+        int truck;
+        bool rejected;
+    };
+
+    struct PickerState {
+        int order;
+        bool blocked;
+        long long blocked_since;
+    };
+
+    struct TruckState {
+        int order;
+        int position;
+        bool moving_up;
+    };
+
+    class DepthTracker {
+    private:
+        long long depth;
+        long long peak;
+        long double area;
+        long long since;
+
+    public:
+        DepthTracker() : depth(0), peak(0), area(0), since(0) {}
+
+        void set(long long time, long long value) {
+            area += (long double)depth * (time - since);
+            since = time;
+            depth = value;
+            peak = std::max(peak, value);
+        }
+
+        long long maximum() const { return peak; }
+        double average(long long span) const { return span > 0 ? (double)(area / span) : 0; }
+    };
+
+    WarehouseDataset dataset;
+    PipelineConfig config;
+    std::vector<OrderRecord> records;
+    std::vector<int> arrival_order;
+    std::vector<PickerState> pickers;
+    std::vector<TruckState> trucks;
+    std::vector<int> idle_pickers;
+    std::vector<int> idle_trucks;
+    std::deque<int> blocked_pickers;
+    std::priority_queue<PickEntry, std::vector<PickEntry>, std::greater<PickEntry>> pick_queue;
+    std::deque<int> staging;
+    std::deque<int> dock_fifo;
+    DockSet dock_by_cylinder;
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events;
+    std::vector<int> free_size;
+    int next_fit_index;
+    int largest_rack;
+    int stock_level;
+    int occupied_racks;
+    int dispatched;
+    int rejected;
+    long long now;
+    long long makespan;
+    long long pick_busy;
+    long long picker_blocked;
+    long long truck_busy;
+    long long truck_distance;
+    long long stock_starved;
+    long long rack_stalled;
+    bool staging_stalled;
+    DepthTracker stock_depth;
+    DepthTracker pick_depth;
+    DepthTracker staging_depth;
+    DepthTracker dock_depth;
+    DepthTracker rack_depth;
+    LatencyHistogram pick_wait;
+    LatencyHistogram rack_wait;
+    LatencyHistogram truck_wait;
+    LatencyHistogram end_to_end;
+
+public:
+    OrderPipeline(const WarehouseDataset& data, const PipelineConfig& cfg)
+        : dataset(data), config(cfg), next_fit_index(0), largest_rack(0), stock_level(0), occupied_racks(0), dispatched(0),
+          rejected(0), now(0), makespan(0), pick_busy(0), picker_blocked(0), truck_busy(0), truck_distance(0),
+          stock_starved(0), rack_stalled(0), staging_stalled(false) {
+        config.num_pickers = std::max(1, config.num_pickers);
+        config.num_trucks = std::max(1, config.num_trucks);
+        config.staging_capacity = std::max(1, config.staging_capacity);
+        config.restock_interval = std::max(1, config.restock_interval);
+        config.restock_batch = std::max(1, config.restock_batch);
+        config.load_time = std::max(0, config.load_time);
+        config.cylinders_per_unit = std::max(1, config.cylinders_per_unit);
+    }
+
+    void run() {
+        PROFILE_SCOPE("OrderPipeline::run");
+        reset();
+        size_t next_arrival = 0;
+        int total = (int)records.size();
+
+        while (dispatched + rejected < total) {
+            long long next_time = LLONG_MAX;
+            if (next_arrival < arrival_order.size()) next_time = records[arrival_order[next_arrival]].arrival;
+            if (!events.empty()) next_time = std::min(next_time, events.top().time);
+            advanceClock(next_time);
+
+            while (!events.empty() && events.top().time == now) {
+                Event event = events.top();
+                events.pop();
+                handle(event);
+            }
+            while (next_arrival < arrival_order.size() && records[arrival_order[next_arrival]].arrival == now) {
+                admit(arrival_order[next_arrival++]);
+            }
+            dispatchWork();
+            sampleDepths();
+        }
+        makespan = now;
+    }
+
+    void runAndReport() {
+        ConsoleUI::printSection("End-to-End Order Pipeline - " + stageSummary());
+        run();
+        displayResults();
+        saveToCSV("output/pipeline_results.csv");
+    }
+
+    int getDispatchedCount() const { return dispatched; }
+    int getRejectedCount() const { return rejected; }
+    long long getMakespan() const { return makespan; }
+    double getThroughput() const { return makespan > 0 ? dispatched / (double)makespan : 0; }
+    const LatencyHistogram& getEndToEndHistogram() const { return end_to_end; }
+
+    double getSaturation(PipelineStage stage) const {
+        if (makespan <= 0) return 0;
+        switch (stage) {
+            case PipelineStage::STOCK: return stock_starved / (double)makespan;
+            case PipelineStage::PICKING: return pick_busy / ((double)config.num_pickers * makespan);
+            case PipelineStage::RACKING: return rack_stalled / (double)makespan;
+            case PipelineStage::TRUCKING: return truck_busy / ((double)config.num_trucks * makespan);
+        }
+        return 0;
+    }
+
+    PipelineStage getBottleneck() const {
+        PipelineStage bottleneck = PipelineStage::PICKING;
+        for (PipelineStage stage : {PipelineStage::STOCK, PipelineStage::RACKING, PipelineStage::TRUCKING}) {
+            if (getSaturation(stage) > getSaturation(bottleneck)) bottleneck = stage;
+        }
+        return bottleneck;
+    }
+
+    static std::string stageName(PipelineStage stage) {
+        switch (stage) {
+            case PipelineStage::STOCK: return "Stock Refill";
+            case PipelineStage::PICKING: return "Picking";
+            case PipelineStage::RACKING: return "Rack Slots";
+            case PipelineStage::TRUCKING: return "Trucks";
+        }
+        return "UNKNOWN";
+    }
+
+    void saveToCSV(const std::string& filename) const {
+        std::vector<std::vector<std::string>> csv_data;
+        csv_data.push_back({"Order_ID", "Arrival_Time", "Pick_Start", "Picked", "Racked", "Dispatched", "Rack_Number", "Truck",
+                            "End_To_End"});
+        for (const auto& r : records) {
+            if (r.rejected) {
+                csv_data.push_back({std::to_string(r.id), std::to_string(r.arrival), "", "", "", "", "Rejected", "", ""});
+                continue;
+            }
+            csv_data.push_back({
+                std::to_string(r.id),
+                std::to_string(r.arrival),
+                std::to_string(r.pick_start),
+                std::to_string(r.picked),
+                std::to_string(r.racked),
+                std::to_string(r.dispatched),
+                "B" + std::to_string((*dataset.memory_blocks)[r.rack].block_id),
+                "T" + std::to_string(r.truck + 1),
+                std::to_string(r.dispatched - r.arrival)
+            });
+        }
+        csv_data.push_back({"Makespan", std::to_string(makespan)});
+        csv_data.push_back({"Bottleneck", stageName(getBottleneck())});
+        FileManager::writeToCSV(filename, csv_data);
+    }
+
+private:
+    std::string stageSummary() const {
+        return algorithmName(config.pick_algorithm) + " picking | " + fitStrategyName(config.rack_strategy) + " racks | "
+               + diskAlgorithmName(config.truck_algorithm) + " trucks";
+    }
+
+    void reset() {
+        const std::vector<Process>& processes = *dataset.processes;
+        const std::vector<DiskRequest>& docks = *dataset.disk_requests;
+        int n = (int)processes.size();
+
+        records.clear();
+        records.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            const Process& p = processes[i];
+            int cylinder = docks.empty() ? dataset.head_position : docks[i % docks.size()].cylinder;
+            records.push_back(OrderRecord{p.id, p.arrival_time, p.burst_time, p.size, p.priority, cylinder, 0, 0, 0, 0, -1, -1, false});
+        }
+
+        std::vector<std::pair<int, int>> by_arrival;
+        by_arrival.reserve(n);
+        for (int i = 0; i < n; ++i) by_arrival.push_back({records[i].arrival, i});
+        std::sort(by_arrival.begin(), by_arrival.end());
+        arrival_order.clear();
+        for (const auto& entry : by_arrival) arrival_order.push_back(entry.second);
+
+        const std::vector<MemoryBlock>& blocks = *dataset.memory_blocks;
+        free_size.assign(blocks.size(), 0);
+        largest_rack = 0;
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            free_size[i] = blocks[i].size;
+            largest_rack = std::max(largest_rack, blocks[i].size);
+        }
+
+        pickers.assign(config.num_pickers, PickerState{-1, false, 0});
+        trucks.assign(config.num_trucks, TruckState{-1, dataset.head_position, true});
+        idle_pickers.clear();
+        idle_trucks.clear();
+        for (int w = config.num_pickers - 1; w >= 0; --w) idle_pickers.push_back(w);
+        for (int t = config.num_trucks - 1; t >= 0; --t) idle_trucks.push_back(t);
+        blocked_pickers.clear();
+        pick_queue = decltype(pick_queue)();
+        staging.clear();
+        dock_fifo.clear();
+        dock_by_cylinder.clear();
+        events = decltype(events)();
+
+        next_fit_index = 0;
+        stock_level = std::max(1, dataset.buffer_size);
+        occupied_racks = 0;
+        dispatched = 0;
+        rejected = 0;
+        now = 0;
+        makespan = 0;
+        pick_busy = 0;
+        picker_blocked = 0;
+        truck_busy = 0;
+        truck_distance = 0;
+        stock_starved = 0;
+        rack_stalled = 0;
+        staging_stalled = false;
+        stock_depth = DepthTracker();
+        pick_depth = DepthTracker();
+        staging_depth = DepthTracker();
+        dock_depth = DepthTracker();
+        rack_depth = DepthTracker();
+        stock_depth.set(0, stock_level);
+        pick_wait.reset();
+        rack_wait.reset();
+        truck_wait.reset();
+        end_to_end.reset();
+
+        if (n > 0) events.push(Event{config.restock_interval, EventType::RESTOCK, 0});
+    }
+
+    void advanceClock(long long time) {
+        long long elapsed = time - now;
+        if (stock_level == 0 && !pick_queue.empty() && !idle_pickers.empty()) stock_starved += elapsed;
+        if (staging_stalled) rack_stalled += elapsed;
+        now = time;
+    }
+
+    void handle(const Event& event) {
+        switch (event.type) {
+            case EventType::RESTOCK:
+                stock_level = std::min(std::max(1, dataset.buffer_size), stock_level + config.restock_batch);
+                if (dispatched + rejected < (int)records.size()) {
+                    events.push(Event{now + config.restock_interval, EventType::RESTOCK, 0});
+                }
+                break;
+            case EventType::PICK_DONE: finishPick(event.target); break;
+            case EventType::TRUCK_DONE: finishTruck(event.target); break;
+        }
+    }
+
+    void admit(int index) {
+        OrderRecord& r = records[index];
+        if (r.size > largest_rack) {
+            r.rejected = true;
+            rejected++;
+            return;
+        }
+        long long key = r.arrival;
+        if (config.pick_algorithm == CPUAlgorithm::SJF || config.pick_algorithm == CPUAlgorithm::SRJF) {
+            key = r.duration;
+        } else if (config.pick_algorithm == CPUAlgorithm::PRIORITY_NON_PREEMPTIVE ||
+                   config.pick_algorithm == CPUAlgorithm::PRIORITY_PREEMPTIVE) {
+            key = -r.priority;
+        }
+        pick_queue.push(PickEntry{key, index});
+    }
+
+    void dispatchWork() {
+        bool progress = true;
+        while (progress) {
+            progress = placeStaged();
+            progress = releaseBlockedPickers() || progress;
+        }
+        startTrucks();
+        startPicks();
+    }
+
+    void startPicks() {
+        while (!idle_pickers.empty() && !pick_queue.empty() && stock_level > 0) {
+            int picker = idle_pickers.back();
+            idle_pickers.pop_back();
+            int index = pick_queue.top().index;
+            pick_queue.pop();
+            stock_level--;
+
+            OrderRecord& r = records[index];
+            r.pick_start = now;
+            pick_wait.record(now - r.arrival);
+            pick_busy += r.duration;
+            pickers[picker].order = index;
+            events.push(Event{now + r.duration, EventType::PICK_DONE, picker});
+        }
+    }
+
+    void finishPick(int picker) {
+        PickerState& state = pickers[picker];
+        records[state.order].picked = now;
+        if ((int)staging.size() < config.staging_capacity) {
+            staging.push_back(state.order);
+            state.order = -1;
+            idle_pickers.push_back(picker);
+        } else {
+            state.blocked = true;
+            state.blocked_since = now;
+            blocked_pickers.push_back(picker);
+        }
+    }
+
+    bool releaseBlockedPickers() {
+        bool progress = false;
+        while (!blocked_pickers.empty() && (int)staging.size() < config.staging_capacity) {
+            int picker = blocked_pickers.front();
+            blocked_pickers.pop_front();
+            PickerState& state = pickers[picker];
+            staging.push_back(state.order);
+            picker_blocked += now - state.blocked_since;
+            state.order = -1;
+            state.blocked = false;
+            idle_pickers.push_back(picker);
+            progress = true;
+        }
+        return progress;
+    }
+
+    bool placeStaged() {
+        bool progress = false;
+        staging_stalled = false;
+        while (!staging.empty()) {
+            int index = staging.front();
+            OrderRecord& r = records[index];
+            int rack = RackFit::choose(config.rack_strategy, free_size.data(), (int)free_size.size(), r.size, next_fit_index);
+            if (rack == -1) {
+                staging_stalled = true;
+                break;
+            }
+            staging.pop_front();
+            free_size[rack] = INT_MIN;
+            occupied_racks++;
+            r.rack = rack;
+            r.racked = now;
+            rack_wait.record(now - r.picked);
+            if (config.truck_algorithm == DiskAlgorithm::FCFS) {
+                dock_fifo.push_back(index);
+            } else {
+                dock_by_cylinder.insert({r.cylinder, index});
+            }
+            progress = true;
+        }
+        return progress;
+    }
+
+    void startTrucks() {
+        while (!idle_trucks.empty() && (!dock_fifo.empty() || !dock_by_cylinder.empty())) {
+            int truck = idle_trucks.back();
+            idle_trucks.pop_back();
+            TruckState& state = trucks[truck];
+
+            long long distance = 0;
+            int index = nextDock(state, distance);
+            OrderRecord& r = records[index];
+            long long travel = (distance + config.cylinders_per_unit - 1) / config.cylinders_per_unit + config.load_time;
+
+            r.truck = truck;
+            truck_wait.record(now - r.racked);
+            truck_busy += travel;
+            truck_distance += distance;
+            state.order = index;
+            state.position = r.cylinder;
+            events.push(Event{now + travel, EventType::TRUCK_DONE, truck});
+        }
+    }
+
+    int nextDock(TruckState& truck, long long& distance) {
+        int head = truck.position;
+        if (config.truck_algorithm == DiskAlgorithm::FCFS) {
+            int index = dock_fifo.front();
+            dock_fifo.pop_front();
+            distance = std::abs((long long)records[index].cylinder - head);
+            return index;
+        }
+
+        DockSet::iterator chosen;
+        switch (config.truck_algorithm) {
+            case DiskAlgorithm::SSTF:
+                chosen = NearestFirstSweep::next(dock_by_cylinder, dataset.max_disk_size, truck.moving_up, head, distance);
+                break;
+            case DiskAlgorithm::SCAN:
+                chosen = ElevatorSweep::next(dock_by_cylinder, dataset.max_disk_size, truck.moving_up, head, distance);
+                break;
+            default:
+                chosen = CircularSweep::next(dock_by_cylinder, dataset.max_disk_size, truck.moving_up, head, distance);
+                break;
+        }
+
+        int index = chosen->second;
+        dock_by_cylinder.erase(chosen);
+        return index;
+    }
+
+    void finishTruck(int truck) {
+        TruckState& state = trucks[truck];
+        OrderRecord& r = records[state.order];
+        r.dispatched = now;
+        free_size[r.rack] = (*dataset.memory_blocks)[r.rack].size;
+        occupied_racks--;
+        dispatched++;
+        end_to_end.record(now - r.arrival);
+        state.order = -1;
+        idle_trucks.push_back(truck);
+    }
+
+    void sampleDepths() {
+        stock_depth.set(now, stock_level);
+        pick_depth.set(now, pick_queue.size());
+        staging_depth.set(now, staging.size());
+        dock_depth.set(now, dock_fifo.size() + dock_by_cylinder.size());
+        rack_depth.set(now, occupied_racks);
+    }
+
+    void displayResults() const {
+        PROFILE_SCOPE("OrderPipeline::displayResults");
+        if (!ConsoleUI::showSummary()) return;
+        ConsoleUI::printSection("PIPELINE RESULTS - " + stageSummary());
+
+        if (ConsoleUI::showItems()) {
+            std::ostringstream table;
+            table << std::left << std::setw(10) << "Order" << std::setw(10) << "Arrival" << std::setw(10) << "Picked"
+                  << std::setw(10) << "Racked" << std::setw(12) << "Dispatched" << std::setw(8) << "Rack" << std::setw(8)
+                  << "Truck" << "\n";
+            table << std::string(68, '-') << "\n";
+            for (const auto& r : records) {
+                table << std::left << std::setw(10) << "P" + std::to_string(r.id) << std::setw(10) << r.arrival;
+                if (r.rejected) {
+                    table << "Rejected (larger than every rack)\n";
+                    continue;
+                }
+                table << std::setw(10) << r.picked << std::setw(10) << r.racked << std::setw(12) << r.dispatched << std::setw(8)
+                      << "B" + std::to_string((*dataset.memory_blocks)[r.rack].block_id) << std::setw(8)
+                      << "T" + std::to_string(r.truck + 1) << "\n";
+            }
+            std::cout << table.str() << "\n";
+        }
+
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "Orders Dispatched: " << dispatched << "/" << records.size();
+        if (rejected > 0) std::cout << " (" << rejected << " rejected: larger than every rack)";
+        std::cout << "\n";
+        std::cout << "Makespan: " << makespan << " units\n";
+        std::cout << "Throughput: " << std::setprecision(4) << getThroughput() << " orders/unit (" << std::setprecision(2)
+                  << getThroughput() * 60 << " orders/hour at 1 unit = 1 minute)\n";
+        std::cout << "Rack Slots Occupied: avg " << rack_depth.average(makespan) << ", max " << rack_depth.maximum() << " of "
+                  << free_size.size() << "\n";
+        std::cout << "Truck Travel: " << truck_distance << " cylinders | Picker Time Blocked by Full Staging: "
+                  << picker_blocked << " units\n\n";
+
+        std::ostringstream stages;
+        stages << std::fixed << std::setprecision(2);
+        stages << std::left << std::setw(16) << "Stage" << std::right << std::setw(10) << "Capacity" << std::setw(12)
+               << "Saturation" << std::setw(12) << "Avg Depth" << std::setw(12) << "Max Depth" << "\n";
+        auto row = [&](PipelineStage stage, int capacity, const DepthTracker& depth) {
+            stages << std::left << std::setw(16) << stageName(stage) << std::right << std::setw(10) << capacity << std::setw(11)
+                   << getSaturation(stage) * 100 << "%" << std::setw(12) << depth.average(makespan) << std::setw(12)
+                   << depth.maximum() << "\n";
+        };
+        row(PipelineStage::STOCK, std::max(1, dataset.buffer_size), stock_depth);
+        row(PipelineStage::PICKING, config.num_pickers, pick_depth);
+        row(PipelineStage::RACKING, (int)free_size.size(), staging_depth);
+        row(PipelineStage::TRUCKING, config.num_trucks, dock_depth);
+        std::cout << stages.str();
+        std::cout << "(Stock depth is the buffer level; other depths count orders waiting for that stage)\n";
+
+        PipelineStage bottleneck = getBottleneck();
+        std::cout << "\nBottleneck: " << stageName(bottleneck) << " (" << getSaturation(bottleneck) * 100 << "% saturated)\n\n";
+
+        LatencyHistogram::printTable(std::cout, "Latency (units)", {{"Pick Wait", &pick_wait}, {"Rack Wait", &rack_wait},
+                                                                    {"Truck Wait", &truck_wait}, {"End-to-End", &end_to_end}});
+    }
+};
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef ORDER_STREAM_H
+#define ORDER_STREAM_H
+
+#include "utilities.h"
+#include "incremental_scheduler.h"
+#include <random>
+#include <chrono>
+#include <cstring>
+
+class OrderStreamReader {
+private:
+    std::istream& in;
+    std::vector<char> buffer;
+    size_t pos;
+    size_t len;
+    long long skipped_lines;
+
+public:
+    explicit OrderStreamReader(std::istream& input)
+        : in(input), buffer(1 << 16), pos(0), len(0), skipped_lines(0) {}
+
+    size_t readChunk(std::vector<Process>& chunk, size_t max_orders) {
+        chunk.clear();
+        std::string line;
+        while (chunk.size() < max_orders && nextLine(line)) {
+            Process p;
+            if (parseOrder(line, p)) {
+                chunk.push_back(p);
+            } else if (!line.empty()) {
+                skipped_lines++;
+            }
+        }
+        return chunk.size();
+    }
+
+    long long getSkippedLines() const { return skipped_lines; }
+
+private:
+    bool nextLine(std::string& line) {
+        line.clear();
+        while (true) {
+            if (pos == len) {
+                in.read(buffer.data(), buffer.size());
+                len = (size_t)in.gcount();
+                pos = 0;
+                if (len == 0) return !line.empty();
+            }
+            const char* start = buffer.data() + pos;
+            const char* newline = static_cast<const char*>(std::memchr(start, '\n', len - pos));
+            if (newline) {
+                line.append(start, newline - start);
+                pos += (newline - start) + 1;
+                if (!line.empty() && line.back() == '\r') line.pop_back();
+                return true;
+            }
+            line.append(start, len - pos);
+            pos = len;
+        }
+    }
+
+    static bool parseField(const char*& cursor, const char* end, int& value) {
+        while (cursor < end && (*cursor == ' ' || *cursor == '\t')) cursor++;
+        bool negative = cursor < end && *cursor == '-';
+        if (negative) cursor++;
+        if (cursor == end || *cursor < '0' || *cursor > '9') return false;
+        long long parsed = 0;
+        while (cursor < end && *cursor >= '0' && *cursor <= '9') {
+            parsed = parsed * 10 + (*cursor++ - '0');
+            if (parsed > INT_MAX) return false;
+        }
+        while (cursor < end && (*cursor == ' ' || *cursor == '\t')) cursor++;
+        value = negative ? -(int)parsed : (int)parsed;
+        return true;
+    }
+
+    static bool parseOrder(const std::string& line, Process& p) {
+        const char* cursor = line.data();
+        const char* end = cursor + line.size();
+        int* fields[4] = {&p.id, &p.arrival_time, &p.burst_time, &p.priority};
+        for (int f = 0; f < 4; ++f) {
+            if (!parseField(cursor, end, *fields[f])) return false;
+            if (f < 3) {
+                if (cursor == end || *cursor != ',') return false;
+                cursor++;
+            }
+        }
+        p.completion_time = p.waiting_time = p.turnaround_time = 0;
+        p.size = p.burst_time;
+        return p.arrival_time >= 0 && p.burst_time > 0;
+    }
+};
+
+class StreamingIngest {
+private:
+    using Clock = std::chrono::steady_clock;
+    static constexpr size_t FLUSH_BYTES = 1 << 16;
+
+    CPUAlgorithm algorithm;
+    int time_quantum;
+    int context_switch_cost;
+    size_t chunk_size;
+
+public:
+    StreamingIngest(CPUAlgorithm algo, int quantum, size_t chunk = 4096)
+        : algorithm(algo), time_quantum(quantum), context_switch_cost(0), chunk_size(std::max<size_t>(1, chunk)) {}
+
+    void setContextSwitchCost(int cost) { context_switch_cost = std::max(0, cost); }
+
+    bool run(std::istream& in, const std::string& output_file) {
+        AsyncWriter& writer = AsyncWriter::instance();
+        long long failures_before = writer.getFailures();
+        WriteMode mode = WriteMode::TRUNCATE;
+        ConsoleUI::printSection("Streaming Ingest - " + algorithmName(algorithm) + " (chunks of "
+                                + std::to_string(chunk_size) + " orders)");
+
+        std::string rows = "Order_ID,Arrival_Time,Burst_Time,Priority,Completion_Time,Waiting_Time,Turnaround_Time\n";
+        IncrementalScheduler scheduler(algorithm, time_quantum);
+        scheduler.setContextSwitchCost(context_switch_cost);
+        scheduler.setTimelineEnabled(false);
+        scheduler.setCompletionSink([&rows, &writer, &mode, &output_file](const Process& p) {
+            rows += std::to_string(p.id) + ',' + std::to_string(p.arrival_time) + ',' + std::to_string(p.burst_time) + ','
+                  + std::to_string(p.priority) + ',' + std::to_string(p.completion_time) + ','
+                  + std::to_string(p.waiting_time) + ',' + std::to_string(p.turnaround_time) + '\n';
+            if (rows.size() >= FLUSH_BYTES) {
+                writer.submit(output_file, std::move(rows), mode);
+                rows = std::string();
+                rows.reserve(FLUSH_BYTES + 128);
+                mode = WriteMode::APPEND;
+            }
+        });
+
+        OrderStreamReader reader(in);
+        std::vector<Process> chunk;
+        chunk.reserve(chunk_size);
+        long long orders_read = 0, rejected = 0;
+        long long next_report = 10000000;
+        auto start = Clock::now();
+
+        while (reader.readChunk(chunk, chunk_size) > 0) {
+            int horizon = 0;
+            for (const auto& p : chunk) {
+                if (!scheduler.addOrder(p)) rejected++;
+                horizon = std::max(horizon, p.arrival_time);
+            }
+            orders_read += chunk.size();
+            scheduler.advanceTo(horizon - 1);
+
+            if (ConsoleUI::showItems() && orders_read >= next_report) {
+                std::cout << "  ... " << orders_read << " orders read, " << scheduler.getCompletedCount()
+                          << " completed, clock " << scheduler.getCurrentTime() << "\n" << std::flush;
+                next_report += 10000000;
+            }
+        }
+        scheduler.runToCompletion();
+        writer.submit(output_file, std::move(rows), mode);
+        writer.flush();
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        scheduler.displayResults();
+        if (ConsoleUI::showSummary()) {
+            std::cout << "Orders Read: " << orders_read << " | Rejected (duplicate ID): " << rejected
+                      << " | Unparsed Lines: " << reader.getSkippedLines() << "\n";
+            std::cout << "Peak Live Orders: " << scheduler.getPeakLiveOrders() << " (memory bound)\n";
+            std::cout << "Elapsed: " << seconds << " s | " << (seconds > 0 ? orders_read / seconds : 0) << " orders/s\n";
+            std::cout << "✅ Results streamed to: " << output_file << "\n";
+        }
+        return writer.getFailures() == failures_before;
+    }
+
+    static void generateOrders(std::ostream& out, long long count, int max_burst_time, int max_priority,
+                               double load, unsigned seed) {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<> burst_dist(1, max_burst_time);
+        std::uniform_int_distribution<> priority_dist(1, max_priority);
+        double mean_gap = (max_burst_time + 1) / 2.0 / std::max(0.01, load);
+        std::uniform_real_distribution<> gap_dist(0, 2 * mean_gap);
+
+        std::string rows;
+        double arrival = 0;
+        for (long long i = 0; i < count && arrival < INT_MAX; ++i) {
+            rows += std::to_string(i + 1) + ',' + std::to_string((long long)arrival) + ','
+                  + std::to_string(burst_dist(gen)) + ',' + std::to_string(priority_dist(gen)) + '\n';
+            arrival += gap_dist(gen);
+            if (rows.size() >= FLUSH_BYTES) {
+                out.write(rows.data(), rows.size());
+                rows.clear();
+            }
+        }
+        out.write(rows.data(), rows.size());
+        out.flush();
+    }
+};
+
+#endif
@@ -0,0 +1,231 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+
+enum class ProfileCounter {
+    COMPARISONS,
+    HEAP_OPERATIONS,
+    ALLOCATIONS,
+    ALLOCATED_BYTES,
+    COUNT
+};
+
+struct ProfileEvent {
+    const char* name;
+    long long start_us;
+    long long duration_us;
+    int thread_id;
+};
+
+struct ScopeStats {
+    long long calls;
+    long long total_us;
+    long long max_us;
+};
+
+class Profiler {
+private:
+    using Clock = std::chrono::steady_clock;
+    static constexpr int NUM_COUNTERS = (int)ProfileCounter::COUNT;
+    static constexpr size_t MAX_TRACE_EVENTS = 1 << 20;
+
+    struct ThreadCounters {
+        std::atomic<long long> values[NUM_COUNTERS];
+
+        ThreadCounters() {
+            for (auto& value : values) value.store(0, std::memory_order_relaxed);
+            Profiler::instance().attach(this);
+        }
+        ~ThreadCounters() { Profiler::instance().detach(this); }
+    };
+
+    std::mutex mtx;
+    Clock::time_point epoch;
+    std::vector<ProfileEvent> events;
+    std::map<std::string, ScopeStats> scopes;
+    std::map<std::thread::id, int> thread_ids;
+    std::vector<ThreadCounters*> live_counters;
+    long long retired[NUM_COUNTERS] = {};
+    size_t dropped_events = 0;
+
+    Profiler() : epoch(Clock::now()) {}
+
+public:
+    static Profiler& instance() {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    static const char* counterName(ProfileCounter counter) {
+        switch (counter) {
+            case ProfileCounter::COMPARISONS: return "comparisons";
+            case ProfileCounter::HEAP_OPERATIONS: return "heap_operations";
+            case ProfileCounter::ALLOCATIONS: return "allocations";
+            case ProfileCounter::ALLOCATED_BYTES: return "allocated_bytes";
+            default: return "unknown";
+        }
+    }
+
+    void count(ProfileCounter counter, long long amount) {
+        thread_local ThreadCounters local;
+        std::atomic<long long>& slot = local.values[(int)counter];
+        slot.store(slot.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    static void countAllocation(size_t bytes) {
+        allocationCounters()[0].fetch_add(1, std::memory_order_relaxed);
+        allocationCounters()[1].fetch_add((long long)bytes, std::memory_order_relaxed);
+    }
+
+    long long total(ProfileCounter counter) {
+        if (counter == ProfileCounter::ALLOCATIONS) return allocationCounters()[0].load(std::memory_order_relaxed);
+        if (counter == ProfileCounter::ALLOCATED_BYTES) return allocationCounters()[1].load(std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(mtx);
+        long long sum = retired[(int)counter];
+        for (const ThreadCounters* counters : live_counters) {
+            sum += counters->values[(int)counter].load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+    Clock::time_point now() const { return Clock::now(); }
+
+    void recordScope(const char* name, Clock::time_point start, Clock::time_point end) {
+        long long start_us = std::chrono::duration_cast<std::chrono::microseconds>(start - epoch).count();
+        long long duration_us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        std::lock_guard<std::mutex> lock(mtx);
+        ScopeStats& stats = scopes[name];
+        stats.calls++;
+        stats.total_us += duration_us;
+        stats.max_us = std::max(stats.max_us, duration_us);
+
+        if (events.size() >= MAX_TRACE_EVENTS) {
+            dropped_events++;
+            return;
+        }
+        auto inserted = thread_ids.emplace(std::this_thread::get_id(), (int)thread_ids.size() + 1);
+        events.push_back({name, start_us, duration_us, inserted.first->second});
+    }
+
+    void displayReport() {
+        long long wall_us = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - epoch).count();
+        std::vector<std::pair<std::string, ScopeStats>> sorted;
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            sorted.assign(scopes.begin(), scopes.end());
+        }
+        std::sort(sorted.begin(), sorted.end(),
+                 [](const auto& a, const auto& b) { return a.second.total_us > b.second.total_us; });
+
+        std::cout << "\n" << std::string(50, '-') << "\n=> PROFILE REPORT\n" << std::string(50, '-') << "\n";
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "Wall Time Since First Scope: " << wall_us / 1000.0 << " ms\n\n";
+        std::cout << std::left << std::setw(44) << "Scope" << std::setw(10) << "Calls" << std::setw(14) << "Total_ms"
+                  << std::setw(12) << "Avg_ms" << std::setw(12) << "Max_ms" << "Wall_%\n";
+        std::cout << std::string(100, '-') << "\n";
+        for (const auto& entry : sorted) {
+            const ScopeStats& s = entry.second;
+            std::cout << std::left << std::setw(44) << entry.first << std::setw(10) << s.calls
+                      << std::setw(14) << s.total_us / 1000.0 << std::setw(12) << s.total_us / 1000.0 / s.calls
+                      << std::setw(12) << s.max_us / 1000.0
+                      << (wall_us > 0 ? s.total_us * 100.0 / wall_us : 0) << "%\n";
+        }
+
+        std::cout << "\n";
+        for (int c = 0; c < NUM_COUNTERS; ++c) {
+            std::cout << std::left << std::setw(20) << counterName((ProfileCounter)c) << total((ProfileCounter)c) << "\n";
+        }
+        if (dropped_events > 0) {
+            std::cout << "(" << dropped_events << " trace events dropped after the first " << MAX_TRACE_EVENTS << ")\n";
+        }
+    }
+
+    bool saveChromeTrace(const std::string& filename) {
+        std::ofstream file(filename);
+        if (!file.is_open()) {
+            std::cerr << "❌ Error: Could not open file " << filename << std::endl;
+            return false;
+        }
+
+        long long counter_values[NUM_COUNTERS];
+        for (int c = 0; c < NUM_COUNTERS; ++c) counter_values[c] = total((ProfileCounter)c);
+
+        std::lock_guard<std::mutex> lock(mtx);
+        long long last_us = 0;
+        std::string out = "{\"traceEvents\":[\n";
+        for (size_t i = 0; i < events.size(); ++i) {
+            const ProfileEvent& e = events[i];
+            out += "{\"name\":\"" + std::string(e.name) + "\",\"cat\":\"warehouse\",\"ph\":\"X\",\"ts\":"
+                + std::to_string(e.start_us) + ",\"dur\":" + std::to_string(e.duration_us)
+                + ",\"pid\":1,\"tid\":" + std::to_string(e.thread_id) + "},\n";
+            last_us = std::max(last_us, e.start_us + e.duration_us);
+            if (out.size() >= (1 << 16)) {
+                file << out;
+                out.clear();
+            }
+        }
+        out += "{\"name\":\"counters\",\"ph\":\"C\",\"ts\":" + std::to_string(last_us) + ",\"pid\":1,\"args\":{";
+        for (int c = 0; c < NUM_COUNTERS; ++c) {
+            out += std::string(c ? "," : "") + "\"" + counterName((ProfileCounter)c) + "\":" + std::to_string(counter_values[c]);
+        }
+        out += "}}\n],\"displayTimeUnit\":\"ms\"}\n";
+        file << out;
+        std::cout << "✅ Chrome trace saved to: " << filename << " (open in chrome://tracing or Perfetto)" << std::endl;
+        return file.good();
+    }
+
+private:
+    static std::atomic<long long>* allocationCounters() {
+        static std::atomic<long long> counters[2];
+        return counters;
+    }
+
+    void attach(ThreadCounters* counters) {
+        std::lock_guard<std::mutex> lock(mtx);
+        live_counters.push_back(counters);
+    }
+
+    void detach(ThreadCounters* counters) {
+        std::lock_guard<std::mutex> lock(mtx);
+        for (int c = 0; c < NUM_COUNTERS; ++c) retired[c] += counters->values[c].load(std::memory_order_relaxed);
+        live_counters.erase(std::remove(live_counters.begin(), live_counters.end(), counters), live_counters.end());
+    }
+};
+
+class ScopedTimer {
+private:
+    const char* name;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    explicit ScopedTimer(const char* scope_name) : name(scope_name), start(Profiler::instance().now()) {}
+    ~ScopedTimer() { Profiler::instance().recordScope(name, start, Profiler::instance().now()); }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+
+#define PROFILE_JOIN_INNER(a, b) a##b
+#define PROFILE_JOIN(a, b) PROFILE_JOIN_INNER(a, b)
+
+#ifdef WAREHOUSE_PROFILE
+#define PROFILE_SCOPE(name) ScopedTimer PROFILE_JOIN(profile_scope_, __LINE__)(name)
+#define PROFILE_COUNT(counter, amount) Profiler::instance().count(ProfileCounter::counter, (long long)(amount))
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_COUNT(counter, amount) ((void)0)
+#endif
+
+#endif
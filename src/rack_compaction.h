@@ -0,0 +1,166 @@
+#ifndef RACK_COMPACTION_H
+#define RACK_COMPACTION_H
+
+#include "utilities.h"
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+
+struct RackMove {
+    int process_id;
+    int from_rack;
+    int to_rack;
+    int units;
+};
+
+struct CompactionPlan {
+    int first_rack = -1;
+    int last_rack = -1;
+    long long freed_units = 0;
+    long long largest_free_before = 0;
+    std::vector<RackMove> moves;
+    double planning_ms = 0.0;
+
+    bool empty() const { return first_rack < 0; }
+};
+
+class RackCompactionPlanner {
+private:
+    const std::vector<MemoryBlock>& blocks;
+    std::vector<int> used;
+    std::vector<int> level;
+    std::vector<int> tree_sum;
+    std::vector<int> tree_best;
+    int leaves;
+
+public:
+    RackCompactionPlanner(const std::vector<MemoryBlock>& rack_blocks, const std::vector<Process>& processes)
+        : blocks(rack_blocks), used(rack_blocks.size(), 0), level(rack_blocks.size(), 0), leaves(1) {
+        std::unordered_map<int, int> order_size;
+        order_size.reserve(processes.size());
+        for (const auto& process : processes) order_size.emplace(process.id, process.size);
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            if (!blocks[i].is_allocated) continue;
+            auto order = order_size.find(blocks[i].process_id);
+            used[i] = order != order_size.end() ? order->second : blocks[i].size;
+        }
+    }
+
+    static long long largestFreeRun(const std::vector<MemoryBlock>& racks) {
+        long long best = 0, run = 0;
+        for (const auto& block : racks) {
+            run = block.is_allocated ? 0 : run + block.size;
+            best = std::max(best, run);
+        }
+        return best;
+    }
+
+    CompactionPlan plan(int max_moves = -1) {
+        PROFILE_SCOPE("RackCompactionPlanner::plan");
+        auto start = std::chrono::steady_clock::now();
+        CompactionPlan best;
+        best.largest_free_before = largestFreeRun(blocks);
+        const int n = (int)blocks.size();
+        const int budget = max_moves < 0 ? n : max_moves;
+
+        int largest = 0;
+        for (int i = 0; i < n; ++i) largest = std::max(largest, level[i] = demand(i));
+        if (largest > 4 * n + 1024) {
+            std::vector<int> values(level.begin(), level.end());
+            std::sort(values.begin(), values.end());
+            values.erase(std::unique(values.begin(), values.end()), values.end());
+            for (int& size : level) size = (int)(std::lower_bound(values.begin(), values.end(), size) - values.begin());
+            largest = (int)values.size() - 1;
+        }
+        leaves = 1;
+        while (leaves <= largest) leaves *= 2;
+        tree_sum.assign(2 * leaves, 0);
+        tree_best.assign(2 * leaves, 0);
+        for (int i = 0; i < n; ++i) {
+            if (!blocks[i].is_allocated) update(level[i], -1);
+        }
+
+        long long units = 0;
+        int moves = 0, best_moves = 0;
+        for (int left = 0, right = 0; left < n; ++left) {
+            if (right < left) right = left;
+            while (right < n) {
+                bool allocated = blocks[right].is_allocated;
+                if (allocated && moves == budget) break;
+                update(level[right], 1);
+                if (tree_best[1] > 0) {
+                    update(level[right], -1);
+                    break;
+                }
+                units += blocks[right].size;
+                if (allocated) moves++;
+                right++;
+            }
+            if (units > best.freed_units || (units == best.freed_units && units > 0 && moves < best_moves)) {
+                best.freed_units = units;
+                best.first_rack = left;
+                best.last_rack = right - 1;
+                best_moves = moves;
+            }
+            if (right > left) {
+                update(level[left], -1);
+                units -= blocks[left].size;
+                if (blocks[left].is_allocated) moves--;
+            }
+        }
+
+        if (!best.empty()) assignDestinations(best);
+        best.planning_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return best;
+    }
+
+private:
+    int demand(int rack) const { return blocks[rack].is_allocated ? used[rack] : blocks[rack].size; }
+
+    void update(int leaf, int delta) {
+        int node = leaf + leaves;
+        tree_sum[node] += delta;
+        tree_best[node] = tree_sum[node];
+        for (node /= 2; node > 0; node /= 2) {
+            int left = 2 * node, right = 2 * node + 1;
+            tree_sum[node] = tree_sum[left] + tree_sum[right];
+            tree_best[node] = std::max(tree_best[right], tree_sum[right] + tree_best[left]);
+        }
+    }
+
+    void assignDestinations(CompactionPlan& plan) const {
+        std::vector<std::pair<int, int>> free_racks;
+        for (int i = 0; i < (int)blocks.size(); ++i) {
+            if (!blocks[i].is_allocated && (i < plan.first_rack || i > plan.last_rack)) free_racks.push_back({blocks[i].size, i});
+        }
+        std::sort(free_racks.begin(), free_racks.end());
+        std::vector<int> next_untaken(free_racks.size() + 1);
+        for (size_t i = 0; i < next_untaken.size(); ++i) next_untaken[i] = (int)i;
+        auto untaken = [&next_untaken](int i) {
+            int root = i;
+            while (next_untaken[root] != root) root = next_untaken[root];
+            while (next_untaken[i] != root) {
+                int next = next_untaken[i];
+                next_untaken[i] = root;
+                i = next;
+            }
+            return root;
+        };
+
+        std::vector<int> sources;
+        for (int i = plan.first_rack; i <= plan.last_rack; ++i) {
+            if (blocks[i].is_allocated) sources.push_back(i);
+        }
+        std::sort(sources.begin(), sources.end(), [this](int a, int b) { return used[a] > used[b]; });
+        plan.moves.reserve(sources.size());
+        for (int source : sources) {
+            int first_fit = (int)(std::lower_bound(free_racks.begin(), free_racks.end(), std::make_pair(used[source], -1))
+                                  - free_racks.begin());
+            int target = untaken(first_fit);
+            plan.moves.push_back({blocks[source].process_id, source, free_racks[target].second, used[source]});
+            next_untaken[target] = target + 1;
+        }
+    }
+};
+
+#endif
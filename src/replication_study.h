@@ -0,0 +1,283 @@
+#ifndef REPLICATION_STUDY_H
+#define REPLICATION_STUDY_H
+
+#include "utilities.h"
+#include "data_generator.h"
+#include "cpu_scheduler.h"
+#include "memory_manager.h"
+#include "disk_scheduler.h"
+#include "latency_histogram.h"
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+
+struct ReplicationConfig {
+    GeneratorConfig generator;
+    int replications;
+    unsigned base_seed;
+    int num_threads;
+    int time_quantum;
+    int context_switch_cost;
+};
+
+struct MetricSummary {
+    std::string scope;
+    std::string algorithm;
+    std::string metric;
+    double mean;
+    double stddev;
+    double ci_low;
+    double ci_high;
+};
+
+class ReplicationStudy {
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct MetricColumn {
+        std::string scope;
+        std::string algorithm;
+        std::string metric;
+    };
+
+    static constexpr int NUM_CPU_ALGORITHMS = (int)CPUAlgorithm::ROUND_ROBIN + 1;
+    static constexpr int MLFQ_MODEL = NUM_CPU_ALGORITHMS;
+    static constexpr int CFS_MODEL = NUM_CPU_ALGORITHMS + 1;
+    static constexpr int NUM_CPU_MODELS = NUM_CPU_ALGORITHMS + 2;
+    static constexpr int NUM_FIT_STRATEGIES = (int)FitStrategy::WORST_FIT + 1;
+    static constexpr int NUM_DISK_ALGORITHMS = (int)DiskAlgorithm::CSCAN + 1;
+
+    ReplicationConfig config;
+    std::vector<MetricColumn> columns;
+    std::vector<double> samples;
+    std::vector<unsigned> seeds;
+    std::vector<MetricSummary> summaries;
+    double elapsed_ms;
+
+public:
+    explicit ReplicationStudy(const ReplicationConfig& cfg) : config(cfg), elapsed_ms(0) {
+        config.replications = std::max(1, config.replications);
+        config.num_threads = std::max(1, std::min(config.num_threads, config.replications));
+        config.time_quantum = std::max(1, config.time_quantum);
+
+        for (int a = 0; a < NUM_CPU_MODELS; ++a) {
+            std::string name = cpuModelName(a);
+            for (const char* metric : {"Avg Waiting", "P99 Waiting", "Avg Turnaround", "Avg Response", "Orders/1000 Units",
+                                       "Context Switches"}) {
+                columns.push_back({"CPU", name, metric});
+            }
+        }
+        for (int s = 0; s < NUM_FIT_STRATEGIES; ++s) {
+            columns.push_back({"Rack", fitStrategyName((FitStrategy)s), "Orders Placed %"});
+            columns.push_back({"Rack", fitStrategyName((FitStrategy)s), "Space Used %"});
+        }
+        for (int d = 0; d < NUM_DISK_ALGORITHMS; ++d) {
+            columns.push_back({"Truck", diskAlgorithmName((DiskAlgorithm)d), "Total Seek"});
+            columns.push_back({"Truck", diskAlgorithmName((DiskAlgorithm)d), "Avg Seek"});
+        }
+    }
+
+    static GeneratorConfig defaultConfig(int orders) {
+        GeneratorConfig generator;
+        generator.num_processes = orders;
+        generator.max_burst_time = 20;
+        generator.max_priority = 10;
+        generator.warehouse_size = std::max(1000, orders * 150);
+        generator.max_block_size = 300;
+        generator.max_process_size = 100;
+        generator.num_disk_requests = orders;
+        generator.max_disk_size = 200;
+        generator.head_position = 100;
+        generator.buffer_size = 10;
+        return generator;
+    }
+
+    static MLFQConfig defaultMLFQ(int time_quantum) {
+        return MLFQConfig{{time_quantum, 2 * time_quantum, 4 * time_quantum}, 50 * time_quantum};
+    }
+
+    static CFSConfig defaultCFS(int time_quantum) {
+        return CFSConfig{8 * time_quantum, time_quantum};
+    }
+
+    static unsigned seedFor(unsigned base_seed, int replication) {
+        uint64_t z = ((uint64_t)base_seed << 32) + (uint64_t)replication + 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return (unsigned)(z ^ (z >> 31));
+    }
+
+    void run() {
+        PROFILE_SCOPE("ReplicationStudy::run");
+        int width = (int)columns.size();
+        samples.assign((size_t)config.replications * width, 0);
+        seeds.assign(config.replications, 0);
+        for (int r = 0; r < config.replications; ++r) seeds[r] = seedFor(config.base_seed, r);
+
+        Clock::time_point start = Clock::now();
+        std::atomic<int> next(0);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < config.num_threads; ++t) {
+            workers.push_back(std::thread([this, &next, width]() {
+                for (int r = next.fetch_add(1); r < config.replications; r = next.fetch_add(1)) {
+                    runReplication(seeds[r], &samples[(size_t)r * width]);
+                }
+            }));
+        }
+        for (auto& worker : workers) worker.join();
+        elapsed_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        summarize();
+    }
+
+    void runAndReport() {
+        ConsoleUI::printSection("Monte Carlo Replications - " + std::to_string(config.replications) + " Datasets on "
+                                + std::to_string(config.num_threads) + " Threads");
+        run();
+        displayResults();
+        saveToCSV("output/replication_summary.csv", "output/replication_samples.csv");
+    }
+
+    const std::vector<MetricSummary>& getSummaries() const { return summaries; }
+    double getElapsedMs() const { return elapsed_ms; }
+    int getThreadCount() const { return config.num_threads; }
+
+    void displayResults() const {
+        PROFILE_SCOPE("ReplicationStudy::displayResults");
+        if (!ConsoleUI::showSummary()) return;
+        ConsoleUI::printSection("REPLICATION RESULTS - " + std::to_string(config.replications) + " Replications (base seed "
+                                + std::to_string(config.base_seed) + ")");
+
+        std::ostringstream table;
+        table << std::fixed << std::setprecision(2);
+        table << std::left << std::setw(7) << "Scope" << std::setw(25) << "Algorithm" << std::setw(18) << "Metric" << std::right
+              << std::setw(12) << "Mean" << std::setw(12) << "Std Dev" << std::setw(28) << "95% CI" << "\n";
+        table << std::string(102, '-') << "\n";
+        for (const auto& s : summaries) {
+            std::ostringstream ci;
+            ci << std::fixed << std::setprecision(2) << "[" << s.ci_low << ", " << s.ci_high << "]";
+            table << std::left << std::setw(7) << s.scope << std::setw(25) << s.algorithm << std::setw(18) << s.metric
+                  << std::right << std::setw(12) << s.mean << std::setw(12) << s.stddev << std::setw(28) << ci.str() << "\n";
+        }
+        std::cout << table.str();
+
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "\nWall Time: " << elapsed_ms << " ms | " << (config.replications * 1000.0 / std::max(elapsed_ms, 1e-3))
+                  << " replications/s on " << config.num_threads << " threads\n";
+        if (config.replications < 2) ConsoleUI::printWarning("A single replication has no spread; run at least 2 for intervals");
+    }
+
+    void saveToCSV(const std::string& summary_file, const std::string& samples_file) const {
+        std::vector<std::vector<std::string>> summary;
+        summary.push_back({"Scope", "Algorithm", "Metric", "Mean", "Std_Dev", "CI95_Low", "CI95_High", "Replications"});
+        for (const auto& s : summaries) {
+            summary.push_back({s.scope, s.algorithm, s.metric, std::to_string(s.mean), std::to_string(s.stddev),
+                               std::to_string(s.ci_low), std::to_string(s.ci_high), std::to_string(config.replications)});
+        }
+        FileManager::writeToCSV(summary_file, summary);
+
+        std::vector<std::vector<std::string>> raw;
+        std::vector<std::string> header = {"Replication", "Seed"};
+        for (const auto& c : columns) header.push_back(c.scope + " " + c.algorithm + " " + c.metric);
+        raw.push_back(header);
+        size_t width = columns.size();
+        for (int r = 0; r < config.replications; ++r) {
+            std::vector<std::string> row = {std::to_string(r + 1), std::to_string(seeds[r])};
+            for (size_t k = 0; k < width; ++k) row.push_back(std::to_string(samples[r * width + k]));
+            raw.push_back(row);
+        }
+        FileManager::writeToCSV(samples_file, raw);
+    }
+
+private:
+    static std::string cpuModelName(int model) {
+        if (model == MLFQ_MODEL) return "MLFQ";
+        if (model == CFS_MODEL) return "CFS";
+        return algorithmName((CPUAlgorithm)model);
+    }
+
+    void runReplication(unsigned seed, double* out) const {
+        WarehouseDataGenerator generator;
+        generator.setSeed(seed);
+        generator.generateFromConfig(config.generator);
+        const WarehouseDataset& dataset = generator.getDataset();
+        int n = (int)dataset.processes->size();
+
+        for (int a = 0; a < NUM_CPU_MODELS; ++a) {
+            CPUScheduler scheduler(dataset.processes);
+            scheduler.setContextSwitchCost(config.context_switch_cost);
+            if (a == MLFQ_MODEL) scheduler.scheduleMLFQ(defaultMLFQ(config.time_quantum));
+            else if (a == CFS_MODEL) scheduler.scheduleCFS(defaultCFS(config.time_quantum));
+            else scheduler.schedule((CPUAlgorithm)a, config.time_quantum);
+
+            LatencyHistogram waiting;
+            double turnaround = 0;
+            for (const auto& p : scheduler.getCompleted()) {
+                waiting.record(p.waiting_time);
+                turnaround += p.turnaround_time;
+            }
+            *out++ = waiting.mean();
+            *out++ = waiting.percentile(0.99);
+            *out++ = n > 0 ? turnaround / n : 0;
+            *out++ = scheduler.getResponseHistogram().mean();
+            *out++ = scheduler.getTotalTime() > 0 ? n * 1000.0 / scheduler.getTotalTime() : 0;
+            *out++ = scheduler.getContextSwitches();
+        }
+
+        std::unordered_map<int, int> size_of;
+        size_of.reserve(n);
+        for (const auto& p : *dataset.processes) size_of[p.id] = p.size;
+        for (int s = 0; s < NUM_FIT_STRATEGIES; ++s) {
+            MemoryManager memory(*dataset.memory_blocks, dataset.processes, dataset.warehouse_size, dataset.max_process_size);
+            memory.allocate((FitStrategy)s);
+            long long used = 0;
+            for (const auto& block : memory.getBlocks()) {
+                if (block.is_allocated) used += size_of[block.process_id];
+            }
+            *out++ = n > 0 ? memory.getAllocatedCount() * 100.0 / n : 0;
+            *out++ = dataset.warehouse_size > 0 ? used * 100.0 / dataset.warehouse_size : 0;
+        }
+
+        size_t requests = dataset.disk_requests->size();
+        for (int d = 0; d < NUM_DISK_ALGORITHMS; ++d) {
+            DiskScheduler disk(dataset.disk_requests, dataset.head_position, dataset.max_disk_size);
+            disk.schedule((DiskAlgorithm)d, true);
+            *out++ = disk.getTotalSeekTime();
+            *out++ = requests > 0 ? disk.getTotalSeekTime() / (double)requests : 0;
+        }
+    }
+
+    void summarize() {
+        size_t width = columns.size();
+        int r_count = config.replications;
+        double t = studentT975(r_count - 1);
+        summaries.clear();
+        for (size_t k = 0; k < width; ++k) {
+            double mean = 0, m2 = 0;
+            for (int r = 0; r < r_count; ++r) {
+                double x = samples[r * width + k];
+                double delta = x - mean;
+                mean += delta / (r + 1);
+                m2 += delta * (x - mean);
+            }
+            double stddev = r_count > 1 ? std::sqrt(m2 / (r_count - 1)) : 0;
+            double half = r_count > 1 ? t * stddev / std::sqrt((double)r_count) : 0;
+            summaries.push_back({columns[k].scope, columns[k].algorithm, columns[k].metric, mean, stddev, mean - half,
+                                 mean + half});
+        }
+    }
+
+    static double studentT975(int df) {
+        static const double table[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                       2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                       2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+        if (df < 1) return 0;
+        if (df <= 30) return table[df - 1];
+        const double z = 1.959964;
+        return z + (z * z * z + z) / (4.0 * df);
+    }
+};
+
+#endif
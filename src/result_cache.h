@@ -0,0 +1,179 @@
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+#include "utilities.h"
+#include "data_generator.h"
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <type_traits>
+
+class CacheKey {
+private:
+    uint64_t state;
+
+public:
+    CacheKey() : state(14695981039346656037ULL) {}
+
+    CacheKey& addBytes(const void* data, size_t bytes) {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < bytes; ++i) {
+            state ^= p[i];
+            state *= 1099511628211ULL;
+        }
+        return *this;
+    }
+
+    CacheKey& add(long long value) { return addBytes(&value, sizeof(value)); }
+
+    CacheKey& add(const std::string& text) {
+        add((long long)text.size());
+        return addBytes(text.data(), text.size());
+    }
+
+    CacheKey& add(const char* text) { return add(std::string(text)); }
+
+    uint64_t digest() const { return state; }
+};
+
+class CacheRecord {
+private:
+    std::string bytes;
+    size_t pos;
+    bool ok;
+
+public:
+    CacheRecord() : pos(0), ok(true) {}
+    explicit CacheRecord(std::string payload) : bytes(std::move(payload)), pos(0), ok(true) {}
+
+    const std::string& data() const { return bytes; }
+    bool good() const { return ok && pos == bytes.size(); }
+
+    template <typename T>
+    void put(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "cache records hold plain values");
+        bytes.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    void putVector(const std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable<T>::value, "cache records hold plain values");
+        put((uint64_t)values.size());
+        bytes.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+
+    template <typename T>
+    bool get(T& value) {
+        if (!ok || bytes.size() - pos < sizeof(T)) return ok = false;
+        std::memcpy(&value, bytes.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+
+    template <typename T>
+    bool getVector(std::vector<T>& values) {
+        uint64_t count = 0;
+        if (!get(count) || count > (bytes.size() - pos) / sizeof(T)) return ok = false;
+        values.resize(count);
+        std::memcpy(values.data(), bytes.data() + pos, count * sizeof(T));
+        pos += count * sizeof(T);
+        return true;
+    }
+};
+
+#ifndef WAREHOUSE_ENGINE_VERSION
+#define WAREHOUSE_ENGINE_VERSION 0
+#endif
+
+class ResultCache {
+private:
+    static constexpr char MAGIC[4] = {'W', 'H', 'R', 'C'};
+    static constexpr uint32_t ENGINE_VERSION = WAREHOUSE_ENGINE_VERSION;
+
+    std::string directory;
+    bool enabled;
+    long long hits;
+    long long misses;
+
+public:
+    explicit ResultCache(const std::string& dir = "cache") : directory(dir), enabled(true), hits(0), misses(0) {}
+
+    void setEnabled(bool on) { enabled = on; }
+    bool isEnabled() const { return enabled; }
+    long long getHits() const { return hits; }
+    long long getMisses() const { return misses; }
+    const std::string& getDirectory() const { return directory; }
+
+    static uint64_t hashDataset(const WarehouseDataset& dataset) {
+        CacheKey key;
+        key.add("dataset").add(ENGINE_VERSION);
+        key.add((long long)dataset.processes->size());
+        for (const auto& p : *dataset.processes) key.add(p.id).add(p.arrival_time).add(p.burst_time).add(p.priority).add(p.size);
+        key.add((long long)dataset.memory_blocks->size());
+        for (const auto& b : *dataset.memory_blocks) key.add(b.block_id).add(b.size);
+        key.add((long long)dataset.disk_requests->size());
+        for (const auto& d : *dataset.disk_requests) key.add(d.request_id).add(d.cylinder).add(d.arrival_time);
+        key.add(dataset.warehouse_size).add(dataset.max_process_size).add(dataset.max_disk_size);
+        key.add(dataset.head_position).add(dataset.buffer_size);
+        return key.digest();
+    }
+
+    bool load(const CacheKey& key, CacheRecord& record) {
+        if (!enabled) return false;
+        PROFILE_SCOPE("ResultCache::load");
+        std::ifstream file(pathFor(key.digest()), std::ios::binary);
+        char magic[4];
+        uint32_t version = 0;
+        uint64_t stored_key = 0, size = 0, checksum = 0;
+        if (!file.is_open() || !file.read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+            !readRaw(file, version) || version != ENGINE_VERSION || !readRaw(file, stored_key) ||
+            stored_key != key.digest() || !readRaw(file, size) || !readRaw(file, checksum)) {
+            misses++;
+            return false;
+        }
+        std::string payload(size, '\0');
+        if (!file.read(&payload[0], size) || CacheKey().addBytes(payload.data(), payload.size()).digest() != checksum) {
+            misses++;
+            return false;
+        }
+        record = CacheRecord(std::move(payload));
+        hits++;
+        ConsoleUI::printInfo("Result cache hit (" + hexKey(key.digest()) + ")");
+        return true;
+    }
+
+    void store(const CacheKey& key, const CacheRecord& record) {
+        if (!enabled) return;
+        PROFILE_SCOPE("ResultCache::store");
+        FileManager::createDirectoryIfNeeded(directory);
+        const std::string& payload = record.data();
+        std::string bytes(MAGIC, sizeof(MAGIC));
+        appendRaw(bytes, ENGINE_VERSION);
+        appendRaw(bytes, key.digest());
+        appendRaw(bytes, (uint64_t)payload.size());
+        appendRaw(bytes, CacheKey().addBytes(payload.data(), payload.size()).digest());
+        bytes += payload;
+        AsyncWriter::instance().submit(pathFor(key.digest()), std::move(bytes), WriteMode::REPLACE);
+    }
+
+private:
+    std::string pathFor(uint64_t key) const { return directory + "/" + hexKey(key) + ".bin"; }
+
+    static std::string hexKey(uint64_t key) {
+        char text[17];
+        std::snprintf(text, sizeof(text), "%016llx", (unsigned long long)key);
+        return text;
+    }
+
+    template <typename T>
+    static void appendRaw(std::string& bytes, T value) {
+        bytes.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    static bool readRaw(std::ifstream& file, T& value) {
+        return (bool)file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+};
+
+#endif
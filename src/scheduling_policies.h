@@ -0,0 +1,346 @@
+#ifndef SCHEDULING_POLICIES_H
+#define SCHEDULING_POLICIES_H
+
+#include "utilities.h"
+#include "execution_timeline.h"
+#include "scratch_arena.h"
+#include "simd_kernels.h"
+#include "latency_histogram.h"
+#include <type_traits>
+#include <set>
+
+struct ArrivalOrderPolicy {
+    static constexpr bool preemptive = false;
+    static constexpr bool time_sliced = false;
+    static constexpr bool fifo = true;
+    static long long key(const Process& p, int) { return p.arrival_time; }
+};
+
+struct ShortestBurstPolicy {
+    static constexpr bool preemptive = false;
+    static constexpr bool time_sliced = false;
+    static constexpr bool fifo = false;
+    static long long key(const Process& p, int) { return p.burst_time; }
+};
+
+struct ShortestRemainingPolicy {
+    static constexpr bool preemptive = true;
+    static constexpr bool time_sliced = false;
+    static constexpr bool fifo = false;
+    static long long key(const Process&, int remaining) { return remaining; }
+};
+
+template <bool Preemptive>
+struct HighestPriorityPolicy {
+    static constexpr bool preemptive = Preemptive;
+    static constexpr bool time_sliced = false;
+    static constexpr bool fifo = false;
+    static long long key(const Process& p, int) { return -p.priority; }
+};
+
+struct RoundRobinPolicy {
+    static constexpr bool preemptive = false;
+    static constexpr bool time_sliced = true;
+    static constexpr bool fifo = true;
+    static long long key(const Process&, int) { return 0; }
+};
+
+template <typename Policy>
+class PolicySchedulerCore {
+private:
+    struct ReadyEntry {
+        long long key;
+        int index;
+
+        bool operator>(const ReadyEntry& other) const {
+            if (key != other.key) return key > other.key;
+            return index > other.index;
+        }
+    };
+
+    class FifoReadyQueue {
+    private:
+        ScratchPool pool;
+        ScratchDeque<int> entries;
+
+    public:
+        explicit FifoReadyQueue(ScratchArena& arena) : pool(&arena), entries(&pool) {}
+        bool empty() const { return entries.empty(); }
+        void push(const ReadyEntry& entry) { entries.push_back(entry.index); }
+        int pop() {
+            int index = entries.front();
+            entries.pop_front();
+            return index;
+        }
+    };
+
+    class HeapReadyQueue {
+    private:
+        ScratchVector<ReadyEntry> heap;
+
+    public:
+        explicit HeapReadyQueue(ScratchArena& arena) : heap(&arena) {}
+        bool empty() const { return heap.empty(); }
+        void push(const ReadyEntry& entry) {
+            PROFILE_COUNT(HEAP_OPERATIONS, 1);
+            heap.push_back(entry);
+            std::push_heap(heap.begin(), heap.end(), std::greater<ReadyEntry>());
+        }
+        int pop() {
+            PROFILE_COUNT(HEAP_OPERATIONS, 1);
+            std::pop_heap(heap.begin(), heap.end(), std::greater<ReadyEntry>());
+            int index = heap.back().index;
+            heap.pop_back();
+            return index;
+        }
+    };
+
+    using ReadyQueue = std::conditional_t<Policy::fifo, FifoReadyQueue, HeapReadyQueue>;
+
+public:
+    static int run(std::vector<Process>& orders, int time_quantum, int context_switch_cost, int& context_switches,
+                   ExecutionTimeline& timeline, LatencyHistogram& response) {
+        ScratchArena& arena = ScratchArena::local();
+        int n = (int)orders.size();
+        ScratchVector<int> remaining(n, &arena);
+        ScratchVector<bool> started(n, false, &arena);
+        for (int i = 0; i < n; ++i) remaining[i] = orders[i].burst_time;
+        ReadyQueue ready(arena);
+
+        auto entry = [&](int index) { return ReadyEntry{Policy::key(orders[index], remaining[index]), index}; };
+
+        int current_time = 0;
+        int next = 0;
+        int processed = 0;
+        int running = -1;
+        int last_process = -1;
+        int slice_end = 0;
+        context_switches = 0;
+
+        while (processed < n) {
+            while (next < n && orders[next].arrival_time <= current_time) {
+                ready.push(entry(next));
+                if constexpr (Policy::preemptive) {
+                    if (running != -1 && remaining[running] > 0 && entry(running) > entry(next)) {
+                        ready.push(entry(running));
+                        running = -1;
+                    }
+                }
+                next++;
+            }
+
+            if (running != -1) {
+                if (remaining[running] == 0) {
+                    recordCompletion(orders[running], current_time);
+                    processed++;
+                    running = -1;
+                } else if (current_time == slice_end) {
+                    ready.push(entry(running));
+                    running = -1;
+                }
+                if (processed == n) break;
+            }
+
+            if (running == -1) {
+                if (ready.empty()) {
+                    current_time = std::max(current_time, orders[next].arrival_time);
+                    continue;
+                }
+                running = ready.pop();
+                if (last_process != -1 && last_process != running) {
+                    context_switches++;
+                    current_time += context_switch_cost;
+                }
+                last_process = running;
+                if (!started[running]) {
+                    started[running] = true;
+                    response.record(current_time - orders[running].arrival_time);
+                }
+                int length = Policy::time_sliced ? std::min(time_quantum, remaining[running]) : remaining[running];
+                slice_end = current_time + length;
+            }
+
+            int event_time = slice_end;
+            if (Policy::preemptive && next < n) {
+                event_time = std::max(current_time, std::min(event_time, orders[next].arrival_time));
+            }
+            timeline.record(orders[running].id, current_time, event_time);
+            remaining[running] -= event_time - current_time;
+            current_time = event_time;
+        }
+        return current_time;
+    }
+
+private:
+    static void recordCompletion(Process& p, int current_time) {
+        p.completion_time = current_time;
+        p.turnaround_time = current_time - p.arrival_time;
+        p.waiting_time = p.turnaround_time - p.burst_time;
+    }
+};
+
+class RackFit {
+public:
+    static int choose(FitStrategy strategy, const int* free_size, int n, int size, int& next_fit_index) {
+        switch (strategy) {
+            case FitStrategy::FIRST_FIT:
+                for (int i = 0; i < n; ++i) {
+                    PROFILE_COUNT(COMPARISONS, 1);
+                    if (free_size[i] >= size) return i;
+                }
+                return -1;
+            case FitStrategy::NEXT_FIT:
+                for (int i = 0; i < n; ++i) {
+                    int index = (next_fit_index + i) % n;
+                    PROFILE_COUNT(COMPARISONS, 1);
+                    if (free_size[index] >= size) {
+                        next_fit_index = (index + 1) % n;
+                        return index;
+                    }
+                }
+                return -1;
+            case FitStrategy::BEST_FIT:
+                PROFILE_COUNT(COMPARISONS, n);
+                return (int)SimdKernels::argMinAtLeast(free_size, n, size);
+            case FitStrategy::WORST_FIT:
+                PROFILE_COUNT(COMPARISONS, n);
+                return (int)SimdKernels::argMaxAtLeast(free_size, n, size);
+        }
+        return -1;
+    }
+};
+
+class HeadTracker {
+private:
+    int head;
+    long long wrap_adjustment;
+    long long pending_wrap;
+    std::vector<int>& sequence;
+    LatencyHistogram& seeks;
+
+public:
+    HeadTracker(int start, std::vector<int>& head_sequence, LatencyHistogram& seek_histogram)
+        : head(start), wrap_adjustment(0), pending_wrap(0), sequence(head_sequence), seeks(seek_histogram) {
+        sequence.clear();
+        sequence.push_back(head);
+        seeks.reset();
+    }
+
+    int position() const { return head; }
+    int seekTime() const { return (int)(SimdKernels::sumAbsDelta(sequence.data(), sequence.size()) + wrap_adjustment); }
+
+    int finish() {
+        if (pending_wrap > 0) seeks.record(pending_wrap);
+        pending_wrap = 0;
+        return seekTime();
+    }
+
+    void moveTo(int cylinder) {
+        seeks.record(std::abs((long long)cylinder - head) + pending_wrap);
+        pending_wrap = 0;
+        head = cylinder;
+        sequence.push_back(head);
+    }
+
+    void wrapTo(int end, int cylinder, int return_cost) {
+        pending_wrap = std::abs((long long)end - head) + return_cost;
+        wrap_adjustment += pending_wrap - std::abs((long long)cylinder - head);
+        head = cylinder;
+        sequence.push_back(head);
+    }
+};
+
+using DockQueue = ScratchVector<std::pair<int, int>>;
+using DockSet = std::set<std::pair<int, int>>;
+
+struct NearestFirstSweep {
+    static DockSet::iterator next(DockSet& docks, int, bool&, int head, long long& distance) {
+        auto above = docks.lower_bound({head, INT_MIN});
+        auto chosen = above;
+        if (above == docks.end() || (above != docks.begin() && head - std::prev(above)->first <= above->first - head)) {
+            chosen = std::prev(above);
+        }
+        distance = std::abs((long long)chosen->first - head);
+        return chosen;
+    }
+
+    static void sweep(const DockQueue& docks, int, bool, HeadTracker& head) {
+        ScratchVector<int> run_start(docks.size(), &ScratchArena::local());
+        for (size_t i = 0; i < docks.size(); ++i) {
+            run_start[i] = i > 0 && docks[i].first == docks[i - 1].first ? run_start[i - 1] : (int)i;
+        }
+
+        size_t hi = std::lower_bound(docks.begin(), docks.end(), std::make_pair(head.position(), INT_MIN)) - docks.begin();
+        size_t lo = hi;
+        while (lo > 0 || hi < docks.size()) {
+            bool take_left = hi == docks.size();
+            if (lo > 0 && hi < docks.size()) {
+                int left = head.position() - docks[lo - 1].first;
+                int right = docks[hi].first - head.position();
+                take_left = left < right || (left == right && docks[run_start[lo - 1]].second < docks[hi].second);
+            }
+            PROFILE_COUNT(COMPARISONS, 1);
+            head.moveTo(take_left ? docks[--lo].first : docks[hi++].first);
+        }
+    }
+};
+
+struct ElevatorSweep {
+    static DockSet::iterator next(DockSet& docks, int, bool& move_up, int head, long long& distance) {
+        auto chosen = docks.lower_bound({head, INT_MIN});
+        if (move_up && chosen == docks.end()) move_up = false;
+        if (!move_up) {
+            auto below = docks.upper_bound({head, INT_MAX});
+            if (below == docks.begin()) {
+                move_up = true;
+            } else {
+                chosen = std::prev(below);
+            }
+        }
+        distance = std::abs((long long)chosen->first - head);
+        return chosen;
+    }
+
+    static void sweep(const DockQueue& docks, int, bool move_up, HeadTracker& head) {
+        int n = (int)docks.size();
+        if (move_up) {
+            int start = std::lower_bound(docks.begin(), docks.end(), std::make_pair(head.position(), INT_MIN)) - docks.begin();
+            for (int i = start; i < n; ++i) head.moveTo(docks[i].first);
+            for (int i = start - 1; i >= 0; --i) head.moveTo(docks[i].first);
+        } else {
+            int start = std::upper_bound(docks.begin(), docks.end(), std::make_pair(head.position(), INT_MAX)) - docks.begin();
+            for (int i = start - 1; i >= 0; --i) head.moveTo(docks[i].first);
+            for (int i = start; i < n; ++i) head.moveTo(docks[i].first);
+        }
+    }
+};
+
+struct CircularSweep {
+    static DockSet::iterator next(DockSet& docks, int disk_size, bool&, int head, long long& distance) {
+        auto chosen = docks.lower_bound({head, INT_MIN});
+        if (chosen == docks.end()) {
+            chosen = docks.begin();
+            distance = (long long)(disk_size - head) + disk_size + chosen->first;
+        } else {
+            distance = chosen->first - head;
+        }
+        return chosen;
+    }
+
+    static void sweep(const DockQueue& docks, int disk_size, bool move_up, HeadTracker& head) {
+        int n = (int)docks.size();
+        if (move_up) {
+            int start = std::lower_bound(docks.begin(), docks.end(), std::make_pair(head.position(), INT_MIN)) - docks.begin();
+            for (int i = start; i < n; ++i) head.moveTo(docks[i].first);
+            head.wrapTo(disk_size, 0, disk_size);
+            for (int i = 0; i < start; ++i) head.moveTo(docks[i].first);
+        } else {
+            int start = std::upper_bound(docks.begin(), docks.end(), std::make_pair(head.position(), INT_MAX)) - docks.begin();
+            for (int i = start - 1; i >= 0; --i) head.moveTo(docks[i].first);
+            head.wrapTo(0, disk_size, disk_size);
+            for (int i = n - 1; i >= start; --i) head.moveTo(docks[i].first);
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef SCRATCH_ARENA_H
+#define SCRATCH_ARENA_H
+
+#include <memory_resource>
+#include <vector>
+#include <deque>
+#include <queue>
+#include <map>
+#include <set>
+#include <cstddef>
+#include <algorithm>
+
+class ScratchArena : public std::pmr::memory_resource {
+private:
+    static constexpr size_t INITIAL_CAPACITY = 1 << 16;
+    static constexpr size_t MAX_RETAINED_CAPACITY = 64 << 20;
+
+    std::byte* block;
+    size_t capacity;
+    size_t offset;
+    size_t peak;
+    std::vector<std::pair<void*, size_t>> overflow;
+    size_t overflow_bytes;
+    int depth;
+    long long resets;
+    long long grows;
+
+public:
+    class Scope {
+    private:
+        ScratchArena& arena;
+        size_t mark;
+
+    public:
+        explicit Scope(ScratchArena& scratch = ScratchArena::local()) : arena(scratch), mark(scratch.offset) { arena.depth++; }
+        ~Scope() { arena.release(mark); }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    ScratchArena()
+        : block(nullptr), capacity(0), offset(0), peak(0), overflow_bytes(0), depth(0), resets(0), grows(0) {
+        grow(INITIAL_CAPACITY);
+    }
+
+    ~ScratchArena() override {
+        freeOverflow();
+        ::operator delete(block);
+    }
+
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    static ScratchArena& local() {
+        thread_local ScratchArena arena;
+        return arena;
+    }
+
+    size_t getCapacity() const { return capacity; }
+    size_t getPeakBytes() const { return peak; }
+    long long getResets() const { return resets; }
+    long long getGrows() const { return grows; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        size_t aligned = (offset + alignment - 1) & ~(alignment - 1);
+        if (alignment <= alignof(std::max_align_t) && aligned + bytes <= capacity) {
+            offset = aligned + bytes;
+            peak = std::max(peak, offset + overflow_bytes);
+            return block + aligned;
+        }
+        void* ptr = alignment > alignof(std::max_align_t) ? ::operator new(bytes, std::align_val_t(alignment))
+                                                          : ::operator new(bytes);
+        overflow.push_back({ptr, alignment});
+        overflow_bytes += bytes + alignment;
+        peak = std::max(peak, offset + overflow_bytes);
+        return ptr;
+    }
+
+    void do_deallocate(void*, size_t, size_t) override {}
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    void release(size_t mark) {
+        if (--depth > 0) {
+            offset = mark;
+            return;
+        }
+        resets++;
+        freeOverflow();
+        size_t target = std::min(peak + peak / 2, MAX_RETAINED_CAPACITY);
+        if (target > capacity) grow(target);
+        offset = 0;
+    }
+
+    void freeOverflow() {
+        for (const auto& entry : overflow) {
+            if (entry.second > alignof(std::max_align_t)) {
+                ::operator delete(entry.first, std::align_val_t(entry.second));
+            } else {
+                ::operator delete(entry.first);
+            }
+        }
+        overflow.clear();
+        overflow_bytes = 0;
+    }
+
+    void grow(size_t new_capacity) {
+        ::operator delete(block);
+        block = static_cast<std::byte*>(::operator new(new_capacity));
+        capacity = new_capacity;
+        grows++;
+    }
+};
+
+using ScratchPool = std::pmr::unsynchronized_pool_resource;
+
+template <typename T>
+using ScratchVector = std::pmr::vector<T>;
+
+template <typename T>
+using ScratchDeque = std::pmr::deque<T>;
+
+template <typename T>
+using ScratchQueue = std::queue<T, std::pmr::deque<T>>;
+
+template <typename K, typename V>
+using ScratchMultimap = std::pmr::multimap<K, V>;
+
+template <typename T>
+using ScratchSet = std::pmr::set<T>;
+
+#endif
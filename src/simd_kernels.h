@@ -0,0 +1,281 @@
+#ifndef SIMD_KERNELS_H
+#define SIMD_KERNELS_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+#include <string>
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define WAREHOUSE_SIMD_X86 1
+#endif
+
+enum class SimdLevel {
+    SCALAR,
+    SSE4,
+    AVX2
+};
+
+class SimdKernels {
+public:
+    static constexpr size_t MAX_COLUMNS = 16;
+
+    static SimdLevel detectLevel() {
+#ifdef WAREHOUSE_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+        if (__builtin_cpu_supports("sse4.2")) return SimdLevel::SSE4;
+#endif
+        return SimdLevel::SCALAR;
+    }
+
+    static SimdLevel getLevel() { return level(); }
+    static void setLevel(SimdLevel requested) { level() = std::min(requested, detectLevel()); }
+
+    static std::string levelName(SimdLevel simd) {
+        switch (simd) {
+            case SimdLevel::SCALAR: return "scalar";
+            case SimdLevel::SSE4: return "sse4.2";
+            case SimdLevel::AVX2: return "avx2";
+        }
+        return "unknown";
+    }
+
+    static void sumColumns(const void* records, size_t count, size_t width, long long* sums) {
+        for (size_t c = 0; c < width; ++c) sums[c] = 0;
+        if (width == 0 || width > MAX_COLUMNS) return;
+        const unsigned char* bytes = static_cast<const unsigned char*>(records);
+        size_t total = count * width;
+        size_t done = 0;
+#ifdef WAREHOUSE_SIMD_X86
+        if (level() == SimdLevel::AVX2) done = sumColumnsAVX2(bytes, total, width, sums);
+        else if (level() == SimdLevel::SSE4) done = sumColumnsSSE4(bytes, total, width, sums);
+#endif
+        for (size_t i = done; i < total; ++i) sums[i % width] += loadInt(bytes, i);
+    }
+
+    static long long sumAbsDelta(const int* values, size_t n) {
+        if (n < 2) return 0;
+        size_t done = 1;
+        long long sum = 0;
+#ifdef WAREHOUSE_SIMD_X86
+        if (level() == SimdLevel::AVX2) done = sumAbsDeltaAVX2(values, n, sum);
+        else if (level() == SimdLevel::SSE4) done = sumAbsDeltaSSE4(values, n, sum);
+#endif
+        for (size_t i = done; i < n; ++i) sum += std::llabs((long long)values[i] - values[i - 1]);
+        return sum;
+    }
+
+    static long long argMinAtLeast(const int* values, size_t n, int threshold) {
+        return selectAtLeast<false>(values, n, threshold);
+    }
+
+    static long long argMaxAtLeast(const int* values, size_t n, int threshold) {
+        return selectAtLeast<true>(values, n, threshold);
+    }
+
+private:
+    static SimdLevel& level() {
+        static SimdLevel active = detectLevel();
+        return active;
+    }
+
+    static int loadInt(const unsigned char* bytes, size_t index) {
+        int value;
+        std::memcpy(&value, bytes + index * sizeof(int), sizeof(int));
+        return value;
+    }
+
+    template <bool Max>
+    static bool better(int value, long long index, int best, long long best_index) {
+        if (best_index == -1) return true;
+        if (value != best) return Max ? value > best : value < best;
+        return index < best_index;
+    }
+
+    template <bool Max>
+    static long long selectAtLeast(const int* values, size_t n, int threshold) {
+        int best = 0;
+        long long best_index = -1;
+        size_t done = 0;
+#ifdef WAREHOUSE_SIMD_X86
+        if (threshold > INT_MIN) {
+            if (level() == SimdLevel::AVX2) done = selectAtLeastAVX2<Max>(values, n, threshold, best, best_index);
+            else if (level() == SimdLevel::SSE4) done = selectAtLeastSSE4<Max>(values, n, threshold, best, best_index);
+        }
+#endif
+        for (size_t i = done; i < n; ++i) {
+            if (values[i] >= threshold && better<Max>(values[i], (long long)i, best, best_index)) {
+                best = values[i];
+                best_index = (long long)i;
+            }
+        }
+        return best_index;
+    }
+
+#ifdef WAREHOUSE_SIMD_X86
+    __attribute__((target("avx2")))
+    static size_t sumColumnsAVX2(const unsigned char* bytes, size_t total, size_t width, long long* sums) {
+        size_t block = 8 * width;
+        size_t blocks = total / block;
+        __m256i acc_lo[MAX_COLUMNS], acc_hi[MAX_COLUMNS];
+        for (size_t k = 0; k < width; ++k) acc_lo[k] = acc_hi[k] = _mm256_setzero_si256();
+
+        for (size_t b = 0; b < blocks; ++b) {
+            const unsigned char* base = bytes + b * block * sizeof(int);
+            for (size_t k = 0; k < width; ++k) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(base + k * 8 * sizeof(int)));
+                acc_lo[k] = _mm256_add_epi64(acc_lo[k], _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+                acc_hi[k] = _mm256_add_epi64(acc_hi[k], _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+            }
+        }
+
+        alignas(32) long long lanes[8];
+        for (size_t k = 0; k < width; ++k) {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc_lo[k]);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes + 4), acc_hi[k]);
+            for (size_t j = 0; j < 8; ++j) sums[(k * 8 + j) % width] += lanes[j];
+        }
+        return blocks * block;
+    }
+
+    __attribute__((target("sse4.2")))
+    static size_t sumColumnsSSE4(const unsigned char* bytes, size_t total, size_t width, long long* sums) {
+        size_t block = 4 * width;
+        size_t blocks = total / block;
+        __m128i acc_lo[MAX_COLUMNS], acc_hi[MAX_COLUMNS];
+        for (size_t k = 0; k < width; ++k) acc_lo[k] = acc_hi[k] = _mm_setzero_si128();
+
+        for (size_t b = 0; b < blocks; ++b) {
+            const unsigned char* base = bytes + b * block * sizeof(int);
+            for (size_t k = 0; k < width; ++k) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(base + k * 4 * sizeof(int)));
+                acc_lo[k] = _mm_add_epi64(acc_lo[k], _mm_cvtepi32_epi64(v));
+                acc_hi[k] = _mm_add_epi64(acc_hi[k], _mm_cvtepi32_epi64(_mm_srli_si128(v, 8)));
+            }
+        }
+
+        alignas(16) long long lanes[4];
+        for (size_t k = 0; k < width; ++k) {
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc_lo[k]);
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes + 2), acc_hi[k]);
+            for (size_t j = 0; j < 4; ++j) sums[(k * 4 + j) % width] += lanes[j];
+        }
+        return blocks * block;
+    }
+
+    __attribute__((target("avx2")))
+    static size_t sumAbsDeltaAVX2(const int* values, size_t n, long long& sum) {
+        __m256i acc = _mm256_setzero_si256();
+        size_t i = 1;
+        for (; i + 8 <= n; i += 8) {
+            __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+            __m256i previous = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i - 1));
+            __m256i lo = _mm256_sub_epi64(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(current)),
+                                          _mm256_cvtepi32_epi64(_mm256_castsi256_si128(previous)));
+            __m256i hi = _mm256_sub_epi64(_mm256_cvtepi32_epi64(_mm256_extracti128_si256(current, 1)),
+                                          _mm256_cvtepi32_epi64(_mm256_extracti128_si256(previous, 1)));
+            __m256i lo_sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), lo);
+            __m256i hi_sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), hi);
+            acc = _mm256_add_epi64(acc, _mm256_sub_epi64(_mm256_xor_si256(lo, lo_sign), lo_sign));
+            acc = _mm256_add_epi64(acc, _mm256_sub_epi64(_mm256_xor_si256(hi, hi_sign), hi_sign));
+        }
+        alignas(32) long long lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        sum += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        return i;
+    }
+
+    __attribute__((target("sse4.2")))
+    static size_t sumAbsDeltaSSE4(const int* values, size_t n, long long& sum) {
+        __m128i acc = _mm_setzero_si128();
+        size_t i = 1;
+        for (; i + 4 <= n; i += 4) {
+            __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+            __m128i previous = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i - 1));
+            __m128i lo = _mm_sub_epi64(_mm_cvtepi32_epi64(current), _mm_cvtepi32_epi64(previous));
+            __m128i hi = _mm_sub_epi64(_mm_cvtepi32_epi64(_mm_srli_si128(current, 8)),
+                                       _mm_cvtepi32_epi64(_mm_srli_si128(previous, 8)));
+            __m128i lo_sign = _mm_cmpgt_epi64(_mm_setzero_si128(), lo);
+            __m128i hi_sign = _mm_cmpgt_epi64(_mm_setzero_si128(), hi);
+            acc = _mm_add_epi64(acc, _mm_sub_epi64(_mm_xor_si128(lo, lo_sign), lo_sign));
+            acc = _mm_add_epi64(acc, _mm_sub_epi64(_mm_xor_si128(hi, hi_sign), hi_sign));
+        }
+        alignas(16) long long lanes[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        sum += lanes[0] + lanes[1];
+        return i;
+    }
+
+    template <bool Max>
+    __attribute__((target("avx2")))
+    static size_t selectAtLeastAVX2(const int* values, size_t n, int threshold, int& best, long long& best_index) {
+        size_t limit = std::min<size_t>(n, INT_MAX - 8) & ~(size_t)7;
+        __m256i floor = _mm256_set1_epi32(threshold - 1);
+        __m256i none = _mm256_set1_epi32(-1);
+        __m256i step = _mm256_set1_epi32(8);
+        __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        __m256i lane_best = _mm256_setzero_si256();
+        __m256i lane_index = none;
+
+        for (size_t i = 0; i < limit; i += 8) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+            __m256i eligible = _mm256_cmpgt_epi32(v, floor);
+            __m256i improves = Max ? _mm256_cmpgt_epi32(v, lane_best) : _mm256_cmpgt_epi32(lane_best, v);
+            __m256i take = _mm256_and_si256(eligible, _mm256_or_si256(improves, _mm256_cmpeq_epi32(lane_index, none)));
+            lane_best = _mm256_blendv_epi8(lane_best, v, take);
+            lane_index = _mm256_blendv_epi8(lane_index, index, take);
+            index = _mm256_add_epi32(index, step);
+        }
+
+        alignas(32) int bests[8], indices[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(bests), lane_best);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(indices), lane_index);
+        for (int j = 0; j < 8; ++j) {
+            if (indices[j] != -1 && better<Max>(bests[j], indices[j], best, best_index)) {
+                best = bests[j];
+                best_index = indices[j];
+            }
+        }
+        return limit;
+    }
+
+    template <bool Max>
+    __attribute__((target("sse4.2")))
+    static size_t selectAtLeastSSE4(const int* values, size_t n, int threshold, int& best, long long& best_index) {
+        size_t limit = std::min<size_t>(n, INT_MAX - 4) & ~(size_t)3;
+        __m128i floor = _mm_set1_epi32(threshold - 1);
+        __m128i none = _mm_set1_epi32(-1);
+        __m128i step = _mm_set1_epi32(4);
+        __m128i index = _mm_setr_epi32(0, 1, 2, 3);
+        __m128i lane_best = _mm_setzero_si128();
+        __m128i lane_index = none;
+
+        for (size_t i = 0; i < limit; i += 4) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+            __m128i eligible = _mm_cmpgt_epi32(v, floor);
+            __m128i improves = Max ? _mm_cmpgt_epi32(v, lane_best) : _mm_cmpgt_epi32(lane_best, v);
+            __m128i take = _mm_and_si128(eligible, _mm_or_si128(improves, _mm_cmpeq_epi32(lane_index, none)));
+            lane_best = _mm_blendv_epi8(lane_best, v, take);
+            lane_index = _mm_blendv_epi8(lane_index, index, take);
+            index = _mm_add_epi32(index, step);
+        }
+
+        alignas(16) int bests[4], indices[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(bests), lane_best);
+        _mm_store_si128(reinterpret_cast<__m128i*>(indices), lane_index);
+        for (int j = 0; j < 4; ++j) {
+            if (indices[j] != -1 && better<Max>(bests[j], indices[j], best, best_index)) {
+                best = bests[j];
+                best_index = indices[j];
+            }
+        }
+        return limit;
+    }
+#endif
+};
+
+#endif
@@ -7,6 +7,9 @@
 #include <condition_variable>
 #include <queue>
 #include <chrono>
+#include <atomic>
+#include <memory>
+#include "coroutine_executor.h"
 
 class StockBuffer {
 private:
@@ -17,56 +20,303 @@ private:
     int producer_count;
     int consumer_count;
 
+    struct WaitingProducer {
+        std::coroutine_handle<> handle;
+        CoroutineExecutor* executor;
+        int item;
+    };
+
+    struct WaitingConsumer {
+        std::coroutine_handle<> handle;
+        CoroutineExecutor* executor;
+        int* slot;
+    };
+
+    std::deque<WaitingProducer> waiting_producers;
+    std::deque<WaitingConsumer> waiting_consumers;
+    long long suspensions;
+
 public:
+    class ProduceAwaiter {
+    private:
+        StockBuffer& buffer;
+        CoroutineExecutor& executor;
+        int item;
+
+    public:
+        ProduceAwaiter(StockBuffer& buf, CoroutineExecutor& exec, int item_id) : buffer(buf), executor(exec), item(item_id) {}
+        bool await_ready() { return false; }
+        bool await_suspend(std::coroutine_handle<> handle) { return buffer.suspendProducer(handle, executor, item); }
+        void await_resume() {}
+    };
+
+    class ConsumeAwaiter {
+    private:
+        StockBuffer& buffer;
+        CoroutineExecutor& executor;
+        int item;
+
+    public:
+        ConsumeAwaiter(StockBuffer& buf, CoroutineExecutor& exec) : buffer(buf), executor(exec), item(0) {}
+        bool await_ready() { return false; }
+        bool await_suspend(std::coroutine_handle<> handle) { return buffer.suspendConsumer(handle, executor, item); }
+        int await_resume() { return item; }
+    };
+
     StockBuffer(int cap, int prod_count, int cons_count)
-        : capacity(cap), producer_count(prod_count), consumer_count(cons_count) {}
+        : capacity(cap), producer_count(prod_count), consumer_count(cons_count), suspensions(0) {}
 
     void produce(int producer_id, int item_id) {
-        std::unique_lock<std::mutex> lock(mtx);
-        cv.wait(lock, [this] { return (int)items.size() < capacity; });
-
-        items.push(item_id);
-        std::cout << "[PRODUCE] Producer " << producer_id << " produced item " << item_id
-                  << " | Buffer: " << items.size() << "/" << capacity << "\n";
+        size_t level;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [this] { return (int)items.size() < capacity; });
+            items.push(item_id);
+            serveWaitingConsumer();
+            level = items.size();
+        }
         cv.notify_all();
+        if (ConsoleUI::showItems()) {
+            std::cout << "[PRODUCE] Producer " + std::to_string(producer_id) + " produced item " + std::to_string(item_id)
+                         + " | Buffer: " + std::to_string(level) + "/" + std::to_string(capacity) + "\n";
+        }
     }
 
     int consume(int consumer_id) {
-        std::unique_lock<std::mutex> lock(mtx);
-        cv.wait(lock, [this] { return !items.empty(); });
-
-        int item = items.front();
-        items.pop();
-        std::cout << "[CONSUME] Consumer " << consumer_id << " consumed item " << item
-                  << " | Buffer: " << items.size() << "/" << capacity << "\n";
+        int item;
+        size_t level;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [this] { return !items.empty(); });
+            item = items.front();
+            items.pop();
+            admitWaitingProducer();
+            level = items.size();
+        }
         cv.notify_all();
+        if (ConsoleUI::showItems()) {
+            std::cout << "[CONSUME] Consumer " + std::to_string(consumer_id) + " consumed item " + std::to_string(item)
+                         + " | Buffer: " + std::to_string(level) + "/" + std::to_string(capacity) + "\n";
+        }
         return item;
     }
 
+    ProduceAwaiter produceAsync(CoroutineExecutor& executor, int item_id) { return ProduceAwaiter(*this, executor, item_id); }
+    ConsumeAwaiter consumeAsync(CoroutineExecutor& executor) { return ConsumeAwaiter(*this, executor); }
+
     int getBufferSize() const {
         std::lock_guard<std::mutex> lock(mtx);
         return items.size();
     }
+
+    long long getSuspensions() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return suspensions;
+    }
+
+private:
+    bool suspendProducer(std::coroutine_handle<> handle, CoroutineExecutor& executor, int item) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if ((int)items.size() >= capacity) {
+                waiting_producers.push_back({handle, &executor, item});
+                suspensions++;
+                return true;
+            }
+            items.push(item);
+            serveWaitingConsumer();
+        }
+        cv.notify_all();
+        return false;
+    }
+
+    bool suspendConsumer(std::coroutine_handle<> handle, CoroutineExecutor& executor, int& slot) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (items.empty()) {
+                waiting_consumers.push_back({handle, &executor, &slot});
+                suspensions++;
+                return true;
+            }
+            slot = items.front();
+            items.pop();
+            admitWaitingProducer();
+        }
+        cv.notify_all();
+        return false;
+    }
+
+    void serveWaitingConsumer() {
+        if (waiting_consumers.empty() || items.empty()) return;
+        WaitingConsumer consumer = waiting_consumers.front();
+        waiting_consumers.pop_front();
+        *consumer.slot = items.front();
+        items.pop();
+        consumer.executor->schedule(consumer.handle);
+    }
+
+    void admitWaitingProducer() {
+        if (waiting_producers.empty() || (int)items.size() >= capacity) return;
+        WaitingProducer producer = waiting_producers.front();
+        waiting_producers.pop_front();
+        items.push(producer.item);
+        producer.executor->schedule(producer.handle);
+    }
+};
+
+class ShardedStockBuffer {
+private:
+    struct alignas(64) Shard {
+        std::mutex mtx;
+        std::deque<int> items;
+        std::atomic<int> count{0};
+        long long local_ops = 0;
+        long long stolen = 0;
+        long long spilled = 0;
+    };
+
+    std::vector<Shard> shards;
+    int shard_capacity;
+    std::atomic<int> sleeping_producers;
+    std::atomic<int> sleeping_consumers;
+    std::mutex space_mtx;
+    std::mutex items_mtx;
+    std::condition_variable has_space;
+    std::condition_variable has_items;
+
+public:
+    ShardedStockBuffer(int capacity_per_shard, int shard_count)
+        : shards(std::max(1, shard_count)), shard_capacity(std::max(1, capacity_per_shard)), sleeping_producers(0),
+          sleeping_consumers(0) {}
+
+    int getShardCount() const { return (int)shards.size(); }
+    int getShardCapacity() const { return shard_capacity; }
+
+    void produce(int producer_id, int item_id) {
+        int home = homeShard(producer_id);
+        int shard = tryPush(home, item_id);
+        if (shard < 0) {
+            std::unique_lock<std::mutex> lock(space_mtx);
+            sleeping_producers++;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            while ((shard = tryPush(home, item_id)) < 0) has_space.wait(lock);
+            sleeping_producers--;
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping_consumers.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(items_mtx);
+            has_items.notify_one();
+        }
+        if (ConsoleUI::showItems()) {
+            std::cout << "[PRODUCE] Producer " + std::to_string(producer_id) + " produced item " + std::to_string(item_id)
+                         + " | Shard " + std::to_string(shard) + ": " + std::to_string(shards[shard].count.load())
+                         + "/" + std::to_string(shard_capacity) + "\n";
+        }
+    }
+
+    int consume(int consumer_id) {
+        int home = homeShard(consumer_id);
+        int item = 0;
+        int shard = tryPop(home, item);
+        if (shard < 0) {
+            std::unique_lock<std::mutex> lock(items_mtx);
+            sleeping_consumers++;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            while ((shard = tryPop(home, item)) < 0) has_items.wait(lock);
+            sleeping_consumers--;
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping_producers.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(space_mtx);
+            has_space.notify_one();
+        }
+        if (ConsoleUI::showItems()) {
+            std::cout << "[CONSUME] Consumer " + std::to_string(consumer_id) + " consumed item " + std::to_string(item)
+                         + " | Shard " + std::to_string(shard) + ": " + std::to_string(shards[shard].count.load())
+                         + "/" + std::to_string(shard_capacity) + "\n";
+        }
+        return item;
+    }
+
+    int getBufferSize() const {
+        int total = 0;
+        for (const auto& shard : shards) total += shard.count.load();
+        return total;
+    }
+
+    long long getLocalOps() const { return sumOf(&Shard::local_ops); }
+    long long getSteals() const { return sumOf(&Shard::stolen); }
+    long long getSpills() const { return sumOf(&Shard::spilled); }
+
+private:
+    int homeShard(int actor_id) const { return (actor_id - 1 + (int)shards.size()) % (int)shards.size(); }
+
+    long long sumOf(long long Shard::*field) const {
+        long long total = 0;
+        for (const auto& shard : shards) total += shard.*field;
+        return total;
+    }
+
+    int tryPush(int home, int item_id) {
+        int n = (int)shards.size();
+        for (int k = 0; k < n; ++k) {
+            int index = (home + k) % n;
+            Shard& shard = shards[index];
+            if (shard.count.load(std::memory_order_relaxed) >= shard_capacity) continue;
+            std::lock_guard<std::mutex> lock(shard.mtx);
+            if ((int)shard.items.size() >= shard_capacity) continue;
+            shard.items.push_back(item_id);
+            shard.count.store((int)shard.items.size(), std::memory_order_relaxed);
+            if (k == 0) shard.local_ops++;
+            else shard.spilled++;
+            return index;
+        }
+        return -1;
+    }
+
+    int tryPop(int home, int& item) {
+        int n = (int)shards.size();
+        for (int k = 0; k < n; ++k) {
+            int index = (home + k) % n;
+            Shard& shard = shards[index];
+            if (shard.count.load(std::memory_order_relaxed) == 0) continue;
+            std::lock_guard<std::mutex> lock(shard.mtx);
+            if (shard.items.empty()) continue;
+            item = shard.items.front();
+            shard.items.pop_front();
+            shard.count.store((int)shard.items.size(), std::memory_order_relaxed);
+            if (k == 0) shard.local_ops++;
+            else shard.stolen++;
+            return index;
+        }
+        return -1;
+    }
 };
 
 class Synchronization {
 private:
     StockBuffer buffer;
+    std::unique_ptr<ShardedStockBuffer> sharded;
     int num_producers;
     int num_consumers;
 
 public:
-    Synchronization(int buffer_size, int prod, int cons)
-        : buffer(buffer_size, prod, cons), num_producers(prod), num_consumers(cons) {}
+    Synchronization(int buffer_size, int prod, int cons, int shards = 1)
+        : buffer(buffer_size, prod, cons), num_producers(prod), num_consumers(cons) {
+        if (shards > 1) sharded = std::make_unique<ShardedStockBuffer>(std::max(1, buffer_size / shards), shards);
+    }
 
     void runProducerConsumer() {
-        ConsoleUI::printSection("Stock Replenishment Coordination - Producer-Consumer");
+        ConsoleUI::printSection(sharded ? "Stock Replenishment Coordination - " + std::to_string(sharded->getShardCount())
+                                              + " Zone Buffers with Work Stealing"
+                                        : std::string("Stock Replenishment Coordination - Producer-Consumer"));
 
         std::vector<std::thread> threads;
 
         for (int i = 1; i <= num_producers; ++i) {
             threads.push_back(std::thread([this, i]() {
-                buffer.produce(i, i * 100);
+                if (sharded) sharded->produce(i, i * 100);
+                else buffer.produce(i, i * 100);
                 std::this_thread::sleep_for(std::chrono::milliseconds(100));
             }));
         }
@@ -75,7 +325,8 @@ public:
 
         for (int i = 1; i <= num_consumers; ++i) {
             threads.push_back(std::thread([this, i]() {
-                int item = buffer.consume(i);
+                if (sharded) sharded->consume(i);
+                else buffer.consume(i);
                 std::this_thread::sleep_for(std::chrono::milliseconds(100));
             }));
         }
@@ -84,8 +335,80 @@ public:
             if (thread.joinable()) thread.join();
         }
 
-        ConsoleUI::printSuccess("Stock coordination completed");
-        std::cout << "Final Buffer Size: " << buffer.getBufferSize() << "\n";
+        if (ConsoleUI::showSummary()) {
+            ConsoleUI::printSuccess("Stock coordination completed");
+            if (sharded) {
+                std::cout << "Final Buffer Size: " << sharded->getBufferSize() << " across " << sharded->getShardCount()
+                          << " shards of " << sharded->getShardCapacity() << "\n";
+                std::cout << "Local Operations: " << sharded->getLocalOps() << " | Steals: " << sharded->getSteals()
+                          << " | Spills: " << sharded->getSpills() << "\n";
+            } else {
+                std::cout << "Final Buffer Size: " << buffer.getBufferSize() << "\n";
+            }
+        }
+    }
+
+    bool runCoroutineProducerConsumer(int items_per_producer, int executor_threads) {
+        ConsoleUI::printSection("Stock Replenishment Coordination - " + std::to_string(num_producers + num_consumers)
+                                + " Coroutine Actors on " + std::to_string(executor_threads) + " Threads");
+        PROFILE_SCOPE("Synchronization::runCoroutineProducerConsumer");
+        auto start = std::chrono::steady_clock::now();
+
+        CoroutineExecutor executor(executor_threads);
+        long long total_items = (long long)num_producers * items_per_producer;
+        std::atomic<long long> consumed_sum(0), consumed_count(0);
+        for (int i = 1; i <= num_producers; ++i) {
+            executor.spawn(producerTask(buffer, executor, i, items_per_producer, (long long)(i - 1) * items_per_producer));
+        }
+        for (int i = 1; i <= num_consumers; ++i) {
+            long long share = total_items / num_consumers + (i <= total_items % num_consumers ? 1 : 0);
+            executor.spawn(consumerTask(buffer, executor, i, share, consumed_sum, consumed_count));
+        }
+        bool completed = executor.run();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        long long expected_sum = total_items * (total_items + 1) / 2;
+        bool balanced = completed && consumed_count.load() == total_items && consumed_sum.load() == expected_sum;
+        if (ConsoleUI::showSummary()) {
+            if (balanced) {
+                ConsoleUI::printSuccess("Stock coordination completed");
+            } else {
+                ConsoleUI::printError("Coroutine actors stalled with " + std::to_string(executor.getLiveTasks()) + " tasks still waiting");
+            }
+            std::cout << std::fixed << std::setprecision(2);
+            std::cout << "Actors: " << num_producers << " producers + " << num_consumers << " consumers\n";
+            std::cout << "Items Produced/Consumed: " << total_items << "/" << consumed_count.load()
+                      << (consumed_sum.load() == expected_sum ? " (checksum ok)" : " (checksum mismatch)") << "\n";
+            std::cout << "Suspensions: " << buffer.getSuspensions() << " | Resumes: " << executor.getResumes() << "\n";
+            std::cout << "Final Buffer Size: " << buffer.getBufferSize() << "\n";
+            std::cout << "Elapsed: " << seconds * 1000 << " ms | " << (seconds > 0 ? total_items / seconds : 0) << " items/s\n";
+        }
+        return balanced;
+    }
+
+private:
+    static Task producerTask(StockBuffer& buffer, CoroutineExecutor& executor, int producer_id, int count, long long first_item) {
+        for (int i = 0; i < count; ++i) {
+            int item = (int)(first_item + i + 1);
+            co_await buffer.produceAsync(executor, item);
+            if (ConsoleUI::showItems()) {
+                std::cout << "[PRODUCE] Producer " + std::to_string(producer_id) + " produced item " + std::to_string(item) + "\n";
+            }
+        }
+    }
+
+    static Task consumerTask(StockBuffer& buffer, CoroutineExecutor& executor, int consumer_id, long long count,
+                             std::atomic<long long>& consumed_sum, std::atomic<long long>& consumed_count) {
+        long long sum = 0;
+        for (long long i = 0; i < count; ++i) {
+            int item = co_await buffer.consumeAsync(executor);
+            sum += item;
+            if (ConsoleUI::showItems()) {
+                std::cout << "[CONSUME] Consumer " + std::to_string(consumer_id) + " consumed item " + std::to_string(item) + "\n";
+            }
+        }
+        consumed_sum += sum;
+        consumed_count += count;
     }
 };
 
@@ -0,0 +1,627 @@
+#ifndef TRACE_IMPORTER_H
+#define TRACE_IMPORTER_H
+
+#include "utilities.h"
+#include <thread>
+#include <chrono>
+#include <cstring>
+#include <cstdint>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+class MappedFile {
+private:
+    const char* bytes;
+    size_t length;
+    bool mapped;
+    std::vector<char> fallback;
+
+public:
+    MappedFile() : bytes(nullptr), length(0), mapped(false) {}
+    ~MappedFile() { close(); }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& path) {
+        close();
+#ifndef _WIN32
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* region = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (region != MAP_FAILED) {
+                madvise(region, (size_t)info.st_size, MADV_SEQUENTIAL);
+                bytes = static_cast<const char*>(region);
+                length = (size_t)info.st_size;
+                mapped = true;
+            }
+        }
+        ::close(fd);
+        if (mapped) return true;
+#endif
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) return false;
+        fallback.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        bytes = fallback.data();
+        length = fallback.size();
+        return true;
+    }
+
+    void close() {
+#ifndef _WIN32
+        if (mapped) munmap(const_cast<char*>(bytes), length);
+#endif
+        mapped = false;
+        bytes = nullptr;
+        length = 0;
+        fallback.clear();
+    }
+
+    const char* data() const { return bytes; }
+    size_t size() const { return length; }
+};
+
+struct TraceImportOptions {
+    std::string orders_path;
+    std::string trucks_path;
+    std::string order_columns;
+    std::string truck_columns;
+    int threads;
+};
+
+struct TraceImportStats {
+    long long rows;
+    long long skipped;
+    size_t bytes;
+    double seconds;
+    int threads;
+    long long time_origin;
+};
+
+class TraceImporter {
+public:
+    static constexpr long long NO_ORIGIN = LLONG_MIN;
+
+private:
+    static constexpr int ORDER_ID = 0;
+    static constexpr int ORDER_ARRIVAL = 1;
+    static constexpr int ORDER_DURATION = 2;
+    static constexpr int ORDER_PRIORITY = 3;
+    static constexpr int ORDER_SIZE = 4;
+    static constexpr int TRUCK_ID = 0;
+    static constexpr int TRUCK_DOCK = 1;
+    static constexpr int TRUCK_ARRIVAL = 2;
+
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int MAX_FIELDS = 5;
+    static constexpr int MAX_COLUMNS = 64;
+    static constexpr size_t MIN_CHUNK_BYTES = 1 << 20;
+    static constexpr size_t TAIL_BYTES = 64;
+    static constexpr long long EMPTY = LLONG_MIN;
+
+    struct FieldSpec {
+        std::vector<std::string> names;
+        int default_position;
+        bool required;
+    };
+
+    template <typename Output>
+    struct Chunk {
+        std::vector<Output> rows;
+        long long lines = 0;
+        long long first_line = 0;
+        long long largest = 0;
+    };
+
+    struct Layout {
+        char delimiter;
+        int field_of[MAX_COLUMNS];
+        int last_column;
+    };
+
+    int num_threads;
+    std::string order_columns;
+    std::string truck_columns;
+    TraceImportStats stats;
+    std::string last_error;
+
+public:
+    explicit TraceImporter(int threads = 0)
+        : num_threads(threads > 0 ? threads : (int)std::max(1u, std::thread::hardware_concurrency())),
+          stats{0, 0, 0, 0, 0, 0} {}
+
+    void setOrderColumns(const std::string& spec) { order_columns = spec; }
+    void setTruckColumns(const std::string& spec) { truck_columns = spec; }
+    const TraceImportStats& getStats() const { return stats; }
+    const std::string& getError() const { return last_error; }
+
+    bool importOrders(const std::string& path, std::vector<Process>& orders, int& largest_size) {
+        static const std::vector<FieldSpec> fields = {
+            {{"id", "order_id", "order"}, 0, false},
+            {{"arrival", "arrival_time", "created", "created_at"}, 1, true},
+            {{"duration", "burst", "burst_time", "pick_time"}, 2, true},
+            {{"priority", "prio"}, 3, false},
+            {{"size", "volume", "order_size"}, 4, false}};
+
+        Clock::time_point start = Clock::now();
+        int columns[MAX_FIELDS];
+        long long origin = 0;
+        std::vector<Chunk<Process>> chunks;
+        bool ok = parseFile(path, fields, order_columns, ORDER_ARRIVAL, columns, origin, chunks,
+                            [&columns, &origin](const long long* v, long long line, Chunk<Process>& chunk) {
+            if (v[ORDER_ARRIVAL] == EMPTY || v[ORDER_DURATION] == EMPTY || (v[ORDER_ID] == EMPTY && columns[ORDER_ID] >= 0)) return;
+            long long id = v[ORDER_ID] == EMPTY ? line : v[ORDER_ID];
+            long long arrival = v[ORDER_ARRIVAL] - origin;
+            long long duration = v[ORDER_DURATION];
+            long long priority = v[ORDER_PRIORITY] == EMPTY ? 1 : v[ORDER_PRIORITY];
+            long long size = v[ORDER_SIZE] == EMPTY ? duration : v[ORDER_SIZE];
+            if (!fitsInt(id) || !fitsInt(arrival) || duration <= 0 || !fitsInt(duration) || !fitsInt(priority) || size < 0 ||
+                !fitsInt(size)) {
+                return;
+            }
+            chunk.rows.push_back(Process{(int)id, (int)arrival, (int)duration, (int)priority, 0, 0, 0, (int)size});
+            chunk.largest = std::max(chunk.largest, size);
+        });
+        if (!ok) return false;
+        if (stats.skipped == totalLines(chunks)) return fail("no usable order rows in " + path + describeSkipped());
+
+        long long low = LLONG_MAX, high = LLONG_MIN;
+        largest_size = 0;
+        for (const auto& chunk : chunks) {
+            largest_size = std::max(largest_size, (int)chunk.largest);
+            for (const auto& order : chunk.rows) {
+                low = std::min(low, (long long)order.arrival_time);
+                high = std::max(high, (long long)order.arrival_time);
+            }
+        }
+        if (low == LLONG_MAX) low = high = 0;
+        if (high - low > INT_MAX) return fail("order arrivals span more than " + std::to_string(INT_MAX) + " time units");
+        stats.time_origin = origin + low;
+
+        bool line_ids = columns[ORDER_ID] < 0;
+        gather(chunks, orders, [low, line_ids](Process& order, const Chunk<Process>& chunk) {
+            order.arrival_time -= (int)low;
+            if (line_ids) order.id += (int)chunk.first_line;
+        });
+        finish(start, (long long)orders.size());
+        return true;
+    }
+
+    bool importTrucks(const std::string& path, std::vector<DiskRequest>& trucks, long long time_origin = NO_ORIGIN) {
+        static const std::vector<FieldSpec> fields = {
+            {{"id", "truck_id", "request_id"}, 0, false},
+            {{"dock", "door", "cylinder", "dock_id"}, 1, true},
+            {{"arrival", "arrival_time", "eta"}, 2, false}};
+
+        Clock::time_point start = Clock::now();
+        int columns[MAX_FIELDS];
+        long long origin = 0;
+        std::vector<Chunk<DiskRequest>> chunks;
+        bool ok = parseFile(path, fields, truck_columns, TRUCK_ARRIVAL, columns, origin, chunks,
+                            [&columns, &origin](const long long* v, long long line, Chunk<DiskRequest>& chunk) {
+            if (v[TRUCK_DOCK] == EMPTY || (v[TRUCK_ID] == EMPTY && columns[TRUCK_ID] >= 0)) return;
+            long long id = v[TRUCK_ID] == EMPTY ? line : v[TRUCK_ID];
+            long long dock = v[TRUCK_DOCK];
+            long long arrival = v[TRUCK_ARRIVAL] == EMPTY ? origin : v[TRUCK_ARRIVAL];
+            if (!fitsInt(id) || dock < 0 || !fitsInt(dock) || !fitsInt(arrival - origin)) return;
+            chunk.rows.push_back(DiskRequest{(int)id, (int)dock, (int)(arrival - origin)});
+        });
+        if (!ok) return false;
+        if (stats.skipped == totalLines(chunks)) return fail("no usable truck rows in " + path + describeSkipped());
+
+        long long low = LLONG_MAX, high = LLONG_MIN;
+        for (const auto& chunk : chunks) {
+            for (const auto& truck : chunk.rows) {
+                low = std::min(low, (long long)truck.arrival_time);
+                high = std::max(high, (long long)truck.arrival_time);
+            }
+        }
+        if (low == LLONG_MAX) low = high = 0;
+        long long shift = time_origin == NO_ORIGIN ? -low : origin - time_origin;
+        if (high + shift > INT_MAX) return fail("truck arrivals fall more than " + std::to_string(INT_MAX) + " time units after the origin");
+        stats.time_origin = time_origin == NO_ORIGIN ? origin + low : time_origin;
+
+        bool line_ids = columns[TRUCK_ID] < 0;
+        gather(chunks, trucks, [shift, line_ids](DiskRequest& truck, const Chunk<DiskRequest>& chunk) {
+            truck.arrival_time = (int)std::max(0LL, truck.arrival_time + shift);
+            if (line_ids) truck.request_id += (int)chunk.first_line;
+        });
+        finish(start, (long long)trucks.size());
+        return true;
+    }
+
+    void printStats(const std::string& label) const {
+        if (!ConsoleUI::showSummary()) return;
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "✓ " << label << ": " << stats.rows << " rows (" << stats.skipped << " skipped) | "
+                  << stats.bytes / 1e6 << " MB in " << stats.seconds * 1000 << " ms ("
+                  << (stats.seconds > 0 ? stats.bytes / 1e6 / stats.seconds : 0) << " MB/s on " << stats.threads
+                  << " threads)\n";
+        if (stats.skipped > stats.rows) {
+            ConsoleUI::printWarning("More than half of the rows were skipped; check the column mapping and field formats");
+        }
+    }
+
+private:
+    bool fail(const std::string& message) {
+        last_error = message;
+        return false;
+    }
+
+    template <typename Output>
+    static long long totalLines(const std::vector<Chunk<Output>>& chunks) {
+        long long lines = 0;
+        for (const auto& chunk : chunks) lines += chunk.lines;
+        return lines;
+    }
+
+    std::string describeSkipped() const {
+        if (stats.skipped == 0) return " (the file has no data rows)";
+        return " (" + std::to_string(stats.skipped) + " rows skipped; check the column mapping and field formats)";
+    }
+
+    void finish(Clock::time_point start, long long rows) {
+        stats.rows = rows;
+        stats.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    static bool fitsInt(long long value) { return value >= INT_MIN && value <= INT_MAX; }
+
+    template <typename Output, typename Convert>
+    bool parseFile(const std::string& path, const std::vector<FieldSpec>& fields, const std::string& spec, int arrival_field,
+                   int* columns, long long& origin, std::vector<Chunk<Output>>& chunks, Convert convert) {
+        PROFILE_SCOPE("TraceImporter::parseFile");
+        stats = TraceImportStats{0, 0, 0, 0, 0, 0};
+
+        MappedFile file;
+        if (!file.open(path)) return fail("could not open " + path);
+        const char* begin = file.data();
+        const char* end = begin + file.size();
+        if (file.size() >= 3 && std::memcmp(begin, "\xEF\xBB\xBF", 3) == 0) begin += 3;
+
+        const char* first_end = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+        if (!first_end) first_end = end;
+        Layout layout;
+        layout.delimiter = detectDelimiter(begin, first_end);
+        std::vector<std::string> header = splitHeader(begin, first_end, layout.delimiter);
+        bool has_header = !header.empty() && !startsNumeric(header[0]);
+        if (!resolveColumns(fields, spec, header, has_header, columns)) return false;
+        const char* body = has_header ? std::min(end, first_end + 1) : begin;
+
+        std::fill(layout.field_of, layout.field_of + MAX_COLUMNS, -1);
+        layout.last_column = 0;
+        for (size_t f = 0; f < fields.size(); ++f) {
+            if (columns[f] < 0) continue;
+            layout.field_of[columns[f]] = (int)f;
+            layout.last_column = std::max(layout.last_column, columns[f]);
+        }
+
+        const char* tail_start = body;
+        if ((size_t)(end - body) > TAIL_BYTES) {
+            tail_start = end - TAIL_BYTES;
+            while (tail_start > body && tail_start[-1] != '\n') tail_start--;
+        }
+        std::string tail(tail_start, end);
+        if (!tail.empty() && tail.back() != '\n') tail.push_back('\n');
+        size_t tail_size = tail.size();
+        tail.append(sizeof(uint64_t), '\0');
+        const char* tail_end = tail.data() + tail_size;
+
+        origin = 0;
+        if (!firstValue(body, tail_start, layout, arrival_field, origin)) firstValue(tail.data(), tail_end, layout, arrival_field, origin);
+
+        int threads = (int)std::max<size_t>(1, std::min<size_t>(num_threads, (tail_start - body) / MIN_CHUNK_BYTES));
+        std::vector<const char*> bounds(threads + 1, tail_start);
+        bounds[0] = body;
+        for (int t = 1; t < threads; ++t) {
+            const char* cut = std::max(body + (size_t)(tail_start - body) * t / threads, bounds[t - 1]);
+            const char* newline = static_cast<const char*>(std::memchr(cut, '\n', tail_start - cut));
+            bounds[t] = newline ? newline + 1 : tail_start;
+        }
+
+        chunks.assign(threads, Chunk<Output>());
+        std::vector<std::thread> workers;
+        for (int t = 1; t < threads; ++t) {
+            workers.push_back(std::thread([&, t]() { parseChunk(bounds[t], bounds[t + 1], layout, chunks[t], convert); }));
+        }
+        parseChunk(bounds[0], bounds[1], layout, chunks[0], convert);
+        for (auto& worker : workers) worker.join();
+        parseChunk(tail.data(), tail_end, layout, chunks[threads - 1], convert);
+
+        long long line = 0;
+        for (auto& chunk : chunks) {
+            chunk.first_line = line;
+            line += chunk.lines;
+            stats.skipped += chunk.lines - (long long)chunk.rows.size();
+        }
+        stats.bytes = file.size();
+        stats.threads = threads;
+        return true;
+    }
+
+    static bool firstValue(const char* cursor, const char* end, const Layout& layout, int field, long long& value) {
+        long long values[MAX_FIELDS];
+        while (cursor < end) {
+            const char* p = cursor;
+            if (parseRow(p, layout, values) && values[field] != EMPTY) {
+                value = values[field];
+                return true;
+            }
+            cursor = static_cast<const char*>(std::memchr(p, '\n', end - p)) + 1;
+        }
+        return false;
+    }
+
+    template <typename Output, typename Convert>
+    static void parseChunk(const char* cursor, const char* end, const Layout& layout, Chunk<Output>& chunk, Convert& convert) {
+        chunk.rows.reserve(chunk.rows.size() + (end - cursor) / 32 + 1);
+        long long values[MAX_FIELDS];
+        while (cursor < end) {
+            chunk.lines++;
+            const char* p = cursor;
+            if (parseRow(p, layout, values)) convert(values, chunk.lines, chunk);
+            if (*p != '\n') p = static_cast<const char*>(std::memchr(p, '\n', end - p));
+            cursor = p + 1;
+        }
+    }
+
+    template <typename Output, typename Adjust>
+    static void gather(std::vector<Chunk<Output>>& chunks, std::vector<Output>& out, Adjust adjust) {
+        if (chunks.size() == 1) {
+            out = std::move(chunks[0].rows);
+            for (auto& row : out) adjust(row, chunks[0]);
+            return;
+        }
+        size_t total = 0;
+        for (const auto& chunk : chunks) total += chunk.rows.size();
+        out.clear();
+        out.reserve(total);
+        for (auto& chunk : chunks) {
+            for (auto& row : chunk.rows) {
+                adjust(row, chunk);
+                out.push_back(row);
+            }
+            chunk.rows = std::vector<Output>();
+        }
+    }
+
+    static bool parseRow(const char*& p, const Layout& layout, long long* values) {
+        std::fill(values, values + MAX_FIELDS, EMPTY);
+        for (int column = 0;; ++column) {
+            int f = layout.field_of[column];
+            if (f >= 0) {
+                if (!parseField(p, layout.delimiter, values[f])) return false;
+            } else {
+                skipField(p, layout.delimiter);
+            }
+            if (column == layout.last_column || *p == '\n') return true;
+            if (*p != layout.delimiter) return false;
+            p++;
+        }
+    }
+
+    static void skipField(const char*& p, char delimiter) {
+        bool quoted = false;
+        while (*p != '\n' && (quoted || *p != delimiter)) {
+            if (*p == '"') quoted = !quoted;
+            p++;
+        }
+    }
+
+    static bool parseField(const char*& p, char delimiter, long long& value) {
+        while (*p == ' ') p++;
+        bool quoted = *p == '"';
+        if (quoted) {
+            p++;
+            while (*p == ' ') p++;
+            if (*p == '"') return closeField(p, delimiter, quoted);
+        } else if (*p == delimiter || *p == '\n' || *p == '\r') {
+            return true;
+        }
+        bool negative = *p == '-';
+        if (negative || *p == '+') p++;
+        const char* digits = p;
+        unsigned long long parsed = 0;
+        uint64_t eight;
+        while (eightDigits(p, eight)) {
+            parsed = parsed * 100000000ULL + eight;
+            p += 8;
+        }
+        while ((unsigned)(*p - '0') <= 9) parsed = parsed * 10 + (unsigned)(*p++ - '0');
+        if (p == digits || p - digits > 18) return false;
+        if (*p == '-' && p - digits == 4 && !negative) {
+            long long seconds;
+            if (!parseTimestamp(p, (long long)parsed, seconds)) return false;
+            value = seconds;
+            return closeField(p, delimiter, quoted);
+        }
+        if (*p == '.') {
+            if ((unsigned)(*++p - '5') <= 4) parsed++;
+            while ((unsigned)(*p - '0') <= 9) p++;
+        }
+        value = negative ? -(long long)parsed : (long long)parsed;
+        return closeField(p, delimiter, quoted);
+    }
+
+    static bool parseTimestamp(const char*& p, long long year, long long& seconds) {
+        int month, day, hour = 0, minute = 0, second = 0;
+        if (!twoDigits(p + 1, month) || p[3] != '-' || !twoDigits(p + 4, day)) return false;
+        p += 6;
+        if ((*p == 'T' || *p == ' ') && (unsigned)(p[1] - '0') <= 9) {
+            if (!twoDigits(p + 1, hour) || p[3] != ':' || !twoDigits(p + 4, minute)) return false;
+            p += 6;
+            if (*p == ':') {
+                if (!twoDigits(p + 1, second)) return false;
+                p += 3;
+            }
+            if (*p == '.') {
+                if ((unsigned)(*++p - '5') <= 4) second++;
+                while ((unsigned)(*p - '0') <= 9) p++;
+            }
+        }
+        long long offset = 0;
+        if (*p == 'Z') {
+            p++;
+        } else if ((*p == '+' || *p == '-') && (unsigned)(p[1] - '0') <= 9) {
+            int offset_hours, offset_minutes = 0;
+            const char* q = p + 1;
+            if (!twoDigits(q, offset_hours)) return false;
+            q += 2;
+            if (*q == ':') q++;
+            if ((unsigned)(*q - '0') <= 9) {
+                if (!twoDigits(q, offset_minutes)) return false;
+                q += 2;
+            }
+            offset = (*p == '-' ? -1 : 1) * (offset_hours * 3600LL + offset_minutes * 60LL);
+            p = q;
+        }
+        if (month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 61) return false;
+        seconds = daysFromCivil(year, month, day) * 86400 + hour * 3600LL + minute * 60LL + second - offset;
+        return true;
+    }
+
+    static bool twoDigits(const char* p, int& value) {
+        if ((unsigned)(p[0] - '0') > 9 || (unsigned)(p[1] - '0') > 9) return false;
+        value = (p[0] - '0') * 10 + (p[1] - '0');
+        return true;
+    }
+
+    static long long daysFromCivil(long long year, int month, int day) {
+        year -= month <= 2;
+        long long era = (year >= 0 ? year : year - 399) / 400;
+        long long year_of_era = year - era * 400;
+        long long day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+        long long day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+        return era * 146097 + day_of_era - 719468;
+    }
+
+    static bool closeField(const char*& p, char delimiter, bool quoted) {
+        while (*p == ' ') p++;
+        if (quoted) {
+            if (*p != '"') return false;
+            p++;
+            while (*p == ' ') p++;
+        }
+        if (*p == '\r') p++;
+        return *p == delimiter || *p == '\n';
+    }
+
+    static bool eightDigits(const char* p, uint64_t& value) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        if (((word & 0xF0F0F0F0F0F0F0F0ULL) | (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) !=
+            0x3333333333333333ULL) {
+            return false;
+        }
+        word -= 0x3030303030303030ULL;
+        word = word * 10 + (word >> 8);
+        value = ((word & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32)) +
+                 ((word >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32))) >> 32;
+        return true;
+#else
+        (void)p;
+        (void)value;
+        return false;
+#endif
+    }
+
+    static char detectDelimiter(const char* begin, const char* end) {
+        long long commas = 0, semicolons = 0, tabs = 0;
+        bool quoted = false;
+        for (const char* p = begin; p < end; ++p) {
+            if (*p == '"') quoted = !quoted;
+            if (quoted) continue;
+            commas += *p == ',';
+            semicolons += *p == ';';
+            tabs += *p == '\t';
+        }
+        if (semicolons > commas && semicolons >= tabs) return ';';
+        if (tabs > commas && tabs > semicolons) return '\t';
+        return ',';
+    }
+
+    static std::vector<std::string> splitHeader(const char* begin, const char* end, char delimiter) {
+        std::vector<std::string> names;
+        if (end > begin && end[-1] == '\r') end--;
+        std::string current;
+        bool quoted = false;
+        for (const char* p = begin; p <= end; ++p) {
+            if (p < end && *p == '"') quoted = !quoted;
+            if (p == end || (*p == delimiter && !quoted)) {
+                size_t first = current.find_first_not_of(" \t\"");
+                size_t last = current.find_last_not_of(" \t\"");
+                std::string name = first == std::string::npos ? "" : current.substr(first, last - first + 1);
+                std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+                names.push_back(name);
+                current.clear();
+            } else {
+                current.push_back(*p);
+            }
+        }
+        return names;
+    }
+
+    static bool startsNumeric(const std::string& text) {
+        size_t i = text.find_first_not_of(" +-");
+        return i != std::string::npos && text[i] >= '0' && text[i] <= '9';
+    }
+
+    static bool isIndex(const std::string& text) {
+        return !text.empty() && std::all_of(text.begin(), text.end(), [](char c) { return c >= '0' && c <= '9'; });
+    }
+
+    bool resolveColumns(const std::vector<FieldSpec>& fields, const std::string& spec, const std::vector<std::string>& header,
+                        bool has_header, int* columns) {
+        auto columnOf = [&header, has_header](const std::string& name) {
+            for (size_t c = 0; has_header && c < header.size(); ++c) {
+                if (header[c] == name) return (int)c;
+            }
+            return -1;
+        };
+
+        for (size_t f = 0; f < fields.size(); ++f) {
+            columns[f] = -1;
+            if (!has_header) {
+                if (fields[f].default_position < (int)header.size()) columns[f] = fields[f].default_position;
+                continue;
+            }
+            for (const auto& name : fields[f].names) {
+                if ((columns[f] = columnOf(name)) >= 0) break;
+            }
+        }
+
+        std::istringstream entries(spec);
+        std::string entry;
+        while (std::getline(entries, entry, ',')) {
+            size_t eq = entry.find('=');
+            if (eq == std::string::npos) return fail("column mapping entry '" + entry + "' is not field=column");
+            std::string field = entry.substr(0, eq), column = entry.substr(eq + 1);
+            std::transform(column.begin(), column.end(), column.begin(), ::tolower);
+            size_t f = 0;
+            while (f < fields.size() && fields[f].names[0] != field) f++;
+            if (f == fields.size()) return fail("unknown field '" + field + "' in column mapping");
+            if (column == "-") {
+                columns[f] = -1;
+                continue;
+            }
+            columns[f] = isIndex(column) ? std::min(std::stoi(column.substr(0, 4)), MAX_COLUMNS) : columnOf(column);
+            if (columns[f] < 0) return fail("column '" + column + "' not found in header");
+        }
+
+        for (size_t f = 0; f < fields.size(); ++f) {
+            if (columns[f] >= MAX_COLUMNS) return fail("column index " + std::to_string(columns[f]) + " is out of range");
+            if (fields[f].required && columns[f] < 0) return fail("no column for required field '" + fields[f].names[0] + "'");
+        }
+        return true;
+    }
+};
+
+#endif
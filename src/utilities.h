@@ -11,6 +11,14 @@
 #include <cmath>
 #include <climits>
 #include <cstdlib>
+#include "profiler.h"
+#include "async_writer.h"
+
+enum class Verbosity {
+    OFF,
+    SUMMARY,
+    PER_ITEM
+};
 
 struct Process {
     int id;
@@ -20,6 +28,7 @@ struct Process {
     int completion_time;
     int waiting_time;
     int turnaround_time;
+    int size;
 };
 
 struct MemoryBlock {
@@ -35,6 +44,71 @@ struct DiskRequest {
     int arrival_time;
 };
 
+enum class CPUAlgorithm {
+    FCFS,
+    SJF,
+    SRJF,
+    PRIORITY_NON_PREEMPTIVE,
+    PRIORITY_PREEMPTIVE,
+    ROUND_ROBIN
+};
+
+enum class FitStrategy {
+    FIRST_FIT,
+    BEST_FIT,
+    NEXT_FIT,
+    WORST_FIT
+};
+
+enum class DiskAlgorithm {
+    FCFS,
+    SSTF,
+    SCAN,
+    CSCAN
+};
+
+inline std::string algorithmName(CPUAlgorithm algorithm) {
+    switch (algorithm) {
+        case CPUAlgorithm::FCFS: return "FCFS";
+        case CPUAlgorithm::SJF: return "SJF";
+        case CPUAlgorithm::SRJF: return "SRJF";
+        case CPUAlgorithm::PRIORITY_NON_PREEMPTIVE: return "PRIORITY_NON_PREEMPTIVE";
+        case CPUAlgorithm::PRIORITY_PREEMPTIVE: return "PRIORITY_PREEMPTIVE";
+        case CPUAlgorithm::ROUND_ROBIN: return "RR";
+    }
+    return "UNKNOWN";
+}
+
+inline bool parseAlgorithmName(const std::string& name, CPUAlgorithm& algorithm) {
+    for (int a = 0; a <= (int)CPUAlgorithm::ROUND_ROBIN; ++a) {
+        if (algorithmName((CPUAlgorithm)a) == name) {
+            algorithm = (CPUAlgorithm)a;
+            return true;
+        }
+    }
+    return false;
+}
+
+inline std::string fitStrategyName(FitStrategy strategy) {
+    switch (strategy) {
+        case FitStrategy::FIRST_FIT: return "First Fit";
+        case FitStrategy::BEST_FIT: return "Best Fit";
+        case FitStrategy::NEXT_FIT: return "Next Fit";
+        case FitStrategy::WORST_FIT: return "Worst Fit";
+    }
+    return "UNKNOWN";
+}
+
+inline std::string diskAlgorithmName(DiskAlgorithm algorithm) {
+    switch (algorithm) {
+        case DiskAlgorithm::FCFS: return "FCFS";
+        case DiskAlgorithm::SSTF: return "SSTF";
+        case DiskAlgorithm::SCAN: return "SCAN";
+        case DiskAlgorithm::CSCAN: return "C-SCAN";
+    }
+    return "UNKNOWN";
+}
+
 class InputValidator {
 public:
     static int getPositiveInteger(const std::string& prompt, int max_value = INT_MAX) {
@@ -90,6 +164,59 @@ public:
     }
 };
 
+class ConsoleUI {
+public:
+    static void setVerbosity(Verbosity level) { verbosity() = level; }
+    static Verbosity getVerbosity() { return verbosity(); }
+    static bool showSummary() { return verbosity() != Verbosity::OFF; }
+    static bool showItems() { return verbosity() == Verbosity::PER_ITEM; }
+
+    static bool parseVerbosity(const std::string& name, Verbosity& level) {
+        if (name == "off") level = Verbosity::OFF;
+        else if (name == "summary") level = Verbosity::SUMMARY;
+        else if (name == "items") level = Verbosity::PER_ITEM;
+        else return false;
+        return true;
+    }
+
+    static void printMenuHeader(const std::string& title) {
+        std::cout << "\n" << std::string(60, '=') << "\n  " << title << "\n" << std::string(60, '=') << "\n";
+    }
+
+    static void printHeader(const std::string& title) {
+        if (showSummary()) printMenuHeader(title);
+    }
+
+    static void printSection(const std::string& section) {
+        if (!showSummary()) return;
+        std::cout << "\n" << std::string(50, '-') << "\n=> " << section << "\n" << std::string(50, '-') << "\n";
+    }
+
+    static void printSuccess(const std::string& msg) {
+        std::cout << "[OK] " << msg << "\n";
+    }
+
+    static void printError(const std::string& msg) {
+        std::cout << "[ERROR] " << msg << "\n";
+    }
+
+    static void printInfo(const std::string& msg) {
+        if (!showSummary()) return;
+        std::cout << "[INFO] " << msg << "\n";
+    }
+
+    static void printWarning(const std::string& msg) {
+        if (!showSummary()) return;
+        std::cout << "[WARN] " << msg << "\n";
+    }
+
+private:
+    static Verbosity& verbosity() {
+        static Verbosity level = Verbosity::PER_ITEM;
+        return level;
+    }
+};
+
 class FileManager {
 public:
     static bool directoryExists(const std::string& path) {
@@ -106,20 +233,38 @@ public:
     }
 
     static void writeToCSV(const std::string& filename, const std::vector<std::vector<std::string>>& data) {
-        std::ofstream file(filename);
-        if (!file.is_open()) {
-            std::cerr << "❌ Error: Could not open file " << filename << std::endl;
-            return;
-        }
+        PROFILE_SCOPE("FileManager::writeToCSV");
+        std::string text;
         for (const auto& row : data) {
             for (size_t i = 0; i < row.size(); ++i) {
-                file << row[i];
-                if (i < row.size() - 1) file << ",";
+                text += row[i];
+                if (i < row.size() - 1) text += ',';
             }
-            file << "\n";
+            text += '\n';
         }
-        file.close();
-        std::cout << "✅ Results saved to: " << filename << std::endl;
+        reportWrite("Results", filename, AsyncWriter::instance().submit(filename, std::move(text)));
+    }
+
+    static void reportWrite(const std::string& what, const std::string& filename, bool accepted, const std::string& detail = "") {
+        if (!ConsoleUI::showSummary()) return;
+        if (!accepted) {
+            ConsoleUI::printError(what + " could not be written to: " + filename);
+        } else if (AsyncWriter::instance().isAsynchronous()) {
+            std::cout << "✅ " << what << " queued for: " << filename << detail << "\n";
+        } else {
+            std::cout << "✅ " << what << " saved to: " << filename << detail << "\n";
+        }
+    }
+
+    static bool flushWrites() {
+        static long long reported = 0;
+        AsyncWriter::instance().flush();
+        long long failures = AsyncWriter::instance().getFailures();
+        if (failures > reported) {
+            ConsoleUI::printError(std::to_string(failures - reported) + " output file(s) could not be written");
+        }
+        reported = failures;
+        return failures == 0;
     }
 
     static void clearDirectory(const std::string& dir_name) {
@@ -132,35 +277,4 @@ public:
     }
 };
 
-class ConsoleUI {
-public:
-    static void printHeader(const std::string& title) {
-        std::cout << "\n" << std::string(60, '=') << std::endl;
-        std::cout << "  " << title << std::endl;
-        std::cout << std::string(60, '=') << std::endl;
-    }
-
-    static void printSection(const std::string& section) {
-        std::cout << "\n" << std::string(50, '-') << std::endl;
-        std::cout << "=> " << section << std::endl;
-        std::cout << std::string(50, '-') << std::endl;
-    }
-
-    static void printSuccess(const std::string& msg) {
-        std::cout << "[OK] " << msg << std::endl;
-    }
-
-    static void printError(const std::string& msg) {
-        std::cout << "[ERROR] " << msg << std::endl;
-    }
-
-    static void printInfo(const std::string& msg) {
-        std::cout << "[INFO] " << msg << std::endl;
-    }
-
-    static void printWarning(const std::string& msg) {
-        std::cout << "[WARN] " << msg << std::endl;
-    }
-};
-
 #endif
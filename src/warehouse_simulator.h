@@ -4,23 +4,30 @@
 #include "data_generator.h"
 #include "cpu_scheduler.h"
 #include "memory_manager.h"
+#include "bin_cache.h"
 #include "disk_scheduler.h"
 #include "synchronization.h"
+#include "worker_pool.h"
+#include "incremental_scheduler.h"
+#include "order_pipeline.h"
+#include "replication_study.h"
+#include "result_cache.h"
+#include "trace_importer.h"
 
 class WarehouseSimulator {
 private:
     WarehouseDataGenerator data_gen;
-    std::vector<Process> processes;
-    std::vector<MemoryBlock> memory_blocks;
-    std::vector<DiskRequest> disk_requests;
-    int warehouse_size;
-    int max_process_size;
-    int max_disk_size;
-    int head_position;
-    int buffer_size;
+    WarehouseDataset dataset;
+    ResultCache result_cache;
+    uint64_t dataset_hash;
+    int context_switch_cost;
+    std::vector<Process> imported_orders;
+    std::vector<DiskRequest> imported_trucks;
+    int largest_imported_order;
 
 public:
-    WarehouseSimulator() : warehouse_size(0), max_process_size(0), max_disk_size(0), head_position(0), buffer_size(0) {
+    WarehouseSimulator()
+        : dataset(data_gen.getDataset()), dataset_hash(0), context_switch_cost(0), largest_imported_order(0) {
         FileManager::createDirectoryIfNeeded("data");
         FileManager::createDirectoryIfNeeded("output");
     }
@@ -39,18 +46,46 @@ public:
         }
 
         data_gen.generateAllData(use_existing);
+        if (!imported_orders.empty()) {
+            ConsoleUI::printInfo("Using " + std::to_string(imported_orders.size()) + " imported orders in place of generated orders");
+            data_gen.useImportedOrders(std::move(imported_orders), largest_imported_order);
+        }
+        if (!imported_trucks.empty()) {
+            ConsoleUI::printInfo("Using " + std::to_string(imported_trucks.size()) + " imported trucks in place of generated trucks");
+            data_gen.useImportedTrucks(std::move(imported_trucks));
+        }
         loadData();
     }
 
+    void setSeed(unsigned seed) { data_gen.setSeed(seed); }
+    void setCacheEnabled(bool enabled) { result_cache.setEnabled(enabled); }
+
+    bool importTraces(const TraceImportOptions& options) {
+        TraceImporter importer(options.threads);
+        importer.setOrderColumns(options.order_columns);
+        importer.setTruckColumns(options.truck_columns);
+        long long time_origin = TraceImporter::NO_ORIGIN;
+        if (!options.orders_path.empty()) {
+            if (!importer.importOrders(options.orders_path, imported_orders, largest_imported_order)) {
+                ConsoleUI::printError("Order trace: " + importer.getError());
+                return false;
+            }
+            importer.printStats("Imported orders");
+            time_origin = importer.getStats().time_origin;
+        }
+        if (!options.trucks_path.empty()) {
+            if (!importer.importTrucks(options.trucks_path, imported_trucks, time_origin)) {
+                ConsoleUI::printError("Truck trace: " + importer.getError());
+                return false;
+            }
+            importer.printStats("Imported trucks");
+        }
+        return true;
+    }
+
     void loadData() {
-        processes = data_gen.getProcesses();
-        memory_blocks = data_gen.getMemoryBlocks();
-        disk_requests = data_gen.getDiskRequests();
-        warehouse_size = data_gen.getWarehouseSize();
-        max_process_size = data_gen.getMaxProcessSize();
-        max_disk_size = data_gen.getMaxDiskSize();
-        head_position = data_gen.getHeadPosition();
-        buffer_size = data_gen.getBufferSize();
+        dataset = data_gen.getDataset();
+        dataset_hash = ResultCache::hashDataset(dataset);
     }
 
     void run() {
@@ -58,7 +93,7 @@ public:
 
         while (true) {
             displayMainMenu();
-            int choice = InputValidator::getChoice(1, 5);
+            int choice = InputValidator::getChoice(1, 7);
 
             switch (choice) {
                 case 1:
@@ -74,6 +109,12 @@ public:
                     runStockReplenishment();
                     break;
                 case 5:
+                    runOrderPipeline();
+                    break;
+                case 6:
+                    runReplicationStudy();
+                    break;
+                case 7:
                     exitSimulation();
                     return;
                 default:
@@ -84,29 +125,40 @@ public:
 
 private:
     void displayMainMenu() {
-        ConsoleUI::printHeader("WAREHOUSE MANAGEMENT SYSTEM MAIN MENU");
+        ConsoleUI::printMenuHeader("WAREHOUSE MANAGEMENT SYSTEM MAIN MENU");
         std::cout << "\n1. 👷 Worker Task Management (CPU Scheduling)\n";
         std::cout << "2. 🏢 Storage Rack Allocation (Memory Management)\n";
         std::cout << "3. 🚚 Truck Movement Management (Disk Scheduling)\n";
         std::cout << "4. 📦 Stock Replenishment Coordination (Synchronization)\n";
-        std::cout << "5. 🚪 Exit\n";
+        std::cout << "5. 🔗 End-to-End Order Pipeline (Pick -> Rack -> Truck)\n";
+        std::cout << "6. 🎲 Monte Carlo Replication Study (Seeded Datasets)\n";
+        std::cout << "7. 🚪 Exit\n";
     }
 
     void runWorkerTaskManagement() {
-        ConsoleUI::printHeader("WORKER TASK MANAGEMENT");
+        ConsoleUI::printMenuHeader("WORKER TASK MANAGEMENT");
         std::cout << "\nSelect a scheduling algorithm:\n";
         std::cout << "A. First Come First Serve (FCFS)\n";
         std::cout << "B. Shortest Job First (SJF)\n";
         std::cout << "C. Shortest Remaining Job First (SRJF)\n";
         std::cout << "D. Priority Scheduling\n";
         std::cout << "E. Round Robin (RR)\n";
-        std::cout << "F. Back to Main Menu\n";
+        std::cout << "F. Parallel Execution (Work-Stealing Worker Pool)\n";
+        std::cout << "G. Multi-Worker Simulation (M Parallel Workers)\n";
+        std::cout << "H. Multilevel Feedback Queue (MLFQ)\n";
+        std::cout << "I. Completely Fair Scheduler (CFS)\n";
+        std::cout << "J. Round Robin Quantum Sweep\n";
+        std::cout << "K. Set Context-Switch Cost (current: " << context_switch_cost << " units)\n";
+        std::cout << "L. Live Shift (Add/Cancel Orders Mid-Shift)\n";
+        std::cout << "M. Back to Main Menu\n";
 
         char algo_choice;
-        std::cout << "Enter choice (A-F): ";
+        std::cout << "Enter choice (A-M): ";
         std::cin >> algo_choice;
 
-        CPUScheduler scheduler(processes);
+        CPUScheduler scheduler(dataset.processes);
+        scheduler.setContextSwitchCost(context_switch_cost);
+        scheduler.setResultCache(&result_cache, dataset_hash);
 
         switch (algo_choice) {
             case 'A':
@@ -136,6 +188,55 @@ private:
                 break;
             case 'F':
             case 'f':
+                runParallelExecution();
+                break;
+            case 'G':
+            case 'g':
+                runMultiWorkerSimulation(scheduler);
+                break;
+            case 'H':
+            case 'h': {
+                MLFQConfig config;
+                int levels = InputValidator::getPositiveInteger("Enter number of queue levels (max 8): ", 8);
+                for (int l = 0; l < levels; ++l) {
+                    config.quanta.push_back(InputValidator::getPositiveInteger(
+                        "  Time quantum for level " + std::to_string(l) + ": ", 1000));
+                }
+                config.boost_period = InputValidator::getPositiveInteger("Enter priority boost period (time units): ");
+                scheduler.runMLFQ(config);
+                break;
+            }
+            case 'I':
+            case 'i': {
+                CFSConfig config;
+                config.target_latency = InputValidator::getPositiveInteger("Enter target scheduling latency (time units): ", 100000);
+                config.min_granularity = InputValidator::getPositiveInteger("Enter minimum granularity (time units): ", 100000);
+                scheduler.runCFS(config);
+                break;
+            }
+            case 'J':
+            case 'j': {
+                int max_quantum = InputValidator::getPositiveInteger("Enter largest time quantum to sweep (max 1000): ", 1000);
+                int step = InputValidator::getPositiveInteger("Enter quantum step: ", max_quantum);
+                scheduler.runQuantumSweep(max_quantum, step);
+                break;
+            }
+            case 'K':
+            case 'k': {
+                char charge = InputValidator::getYesNo("Charge a cost on every context switch");
+                context_switch_cost = 0;
+                if (charge == 'y' || charge == 'Y') {
+                    context_switch_cost = InputValidator::getPositiveInteger("Enter cost per context switch (time units): ", 1000);
+                }
+                ConsoleUI::printSuccess("Context-switch cost set to " + std::to_string(context_switch_cost) + " units");
+                break;
+            }
+            case 'L':
+            case 'l':
+                runLiveShift();
+                break;
+            case 'M':
+            case 'm':
                 return;
             default:
                 ConsoleUI::printError("Invalid choice");
@@ -146,20 +247,110 @@ private:
         std::cin.get();
     }
 
+    void runParallelExecution() {
+        int num_workers = InputValidator::getPositiveInteger("Enter number of worker threads (max 256): ", 256);
+        int unit_us = InputValidator::getPositiveInteger("Enter real work per time unit in microseconds (max 10000): ", 10000);
+        int time_quantum = InputValidator::getPositiveInteger("Enter time quantum for the simulated RR comparison: ", 1000);
+
+        WorkStealingPool pool(num_workers, unit_us);
+        pool.execute(*dataset.processes);
+        pool.compareWithSimulation(dataset.processes, time_quantum);
+    }
+
+    void runLiveShift() {
+        std::cout << "Choose algorithm:\n";
+        std::cout << "1. FCFS\n2. SJF\n3. SRJF\n4. Non-Preemptive Priority\n5. Preemptive Priority\n6. Round Robin\n";
+        CPUAlgorithm algorithm = static_cast<CPUAlgorithm>(InputValidator::getChoice(1, 6) - 1);
+        int time_quantum = 1;
+        if (algorithm == CPUAlgorithm::ROUND_ROBIN) {
+            time_quantum = InputValidator::getPositiveInteger("Enter time quantum (time slice per order): ", 1000);
+        }
+
+        IncrementalScheduler shift(algorithm, time_quantum);
+        shift.setContextSwitchCost(context_switch_cost);
+        int next_id = 1;
+        for (const auto& p : *dataset.processes) {
+            shift.addOrder(p);
+            next_id = std::max(next_id, p.id + 1);
+        }
+
+        ConsoleUI::printSection("Live Shift - " + algorithmName(algorithm) + " with Incremental Rescheduling");
+        while (true) {
+            shift.displayState();
+            std::cout << "1. Add order\n2. Cancel order\n3. Advance clock\n4. Finish shift\n";
+            int action = InputValidator::getChoice(1, 4);
+            if (action == 4) break;
+
+            if (action == 1) {
+                Process order{next_id, 0, 0, 0, 0, 0, 0, 0};
+                order.arrival_time = InputValidator::getPositiveInteger("  Arrival time (earlier times arrive now): ");
+                order.burst_time = InputValidator::getPositiveInteger("  Order completion time (burst): ");
+                order.priority = InputValidator::getPositiveInteger("  Priority (1-10): ", 10);
+                order.size = order.burst_time;
+                if (shift.addOrder(order)) {
+                    ConsoleUI::printSuccess("Order P" + std::to_string(next_id) + " added");
+                    next_id++;
+                }
+            } else if (action == 2) {
+                int order_id = InputValidator::getPositiveInteger("  Order ID to cancel: ");
+                if (shift.cancelOrder(order_id)) {
+                    ConsoleUI::printSuccess("Order P" + std::to_string(order_id) + " cancelled");
+                } else {
+                    ConsoleUI::printError("Order P" + std::to_string(order_id) + " is unknown, finished or already cancelled");
+                }
+            } else {
+                int target = InputValidator::getPositiveInteger("  Advance clock to time: ");
+                shift.advanceTo(target);
+            }
+        }
+
+        shift.runToCompletion();
+        shift.displayResults();
+        shift.saveToCSV("output/live_shift_results.csv");
+    }
+
+    void runMultiWorkerSimulation(CPUScheduler& scheduler) {
+        std::cout << "Choose algorithm:\n";
+        std::cout << "1. FCFS\n2. SJF\n3. SRJF\n4. Non-Preemptive Priority\n5. Preemptive Priority\n6. Round Robin\n";
+        int algo = InputValidator::getChoice(1, 6);
+
+        MultiWorkerConfig config;
+        config.algorithm = static_cast<CPUAlgorithm>(algo - 1);
+        config.num_workers = InputValidator::getPositiveInteger("Enter number of workers (max 4096): ", 4096);
+        std::cout << "Choose queue layout:\n";
+        std::cout << "1. Global ready queue shared by all workers\n";
+        std::cout << "2. Per-worker ready queues\n";
+        config.queue_mode = InputValidator::getChoice(1, 2) == 1 ? QueueMode::GLOBAL : QueueMode::PER_WORKER;
+        config.load_balancing = false;
+        if (config.queue_mode == QueueMode::PER_WORKER) {
+            char balance = InputValidator::getYesNo("Enable load balancing (idle workers migrate queued orders)");
+            config.load_balancing = (balance == 'y' || balance == 'Y');
+        }
+        config.time_quantum = 1;
+        if (config.algorithm == CPUAlgorithm::ROUND_ROBIN) {
+            config.time_quantum = InputValidator::getPositiveInteger("Enter time quantum (time slice per order): ", 1000);
+        }
+
+        scheduler.runMultiWorker(config);
+    }
+
     void runStorageRackAllocation() {
-        ConsoleUI::printHeader("STORAGE RACK ALLOCATION");
+        ConsoleUI::printMenuHeader("STORAGE RACK ALLOCATION");
         std::cout << "\nSelect allocation strategy:\n";
         std::cout << "A. First Fit\n";
         std::cout << "B. Best Fit\n";
         std::cout << "C. Next Fit\n";
         std::cout << "D. Worst Fit\n";
-        std::cout << "E. Back to Main Menu\n";
+        std::cout << "E. Forward-Pick Bin Cache (Page Replacement)\n";
+        std::cout << "F. Rack Compaction Planner (Defragmentation)\n";
+        std::cout << "G. Back to Main Menu\n";
 
         char alloc_choice;
-        std::cout << "Enter choice (A-E): ";
+        std::cout << "Enter choice (A-G): ";
         std::cin >> alloc_choice;
 
-        MemoryManager memory_mgr(memory_blocks, processes, warehouse_size, max_process_size);
+        MemoryManager memory_mgr(*dataset.memory_blocks, dataset.processes, dataset.warehouse_size, dataset.max_process_size);
+        memory_mgr.setResultCache(&result_cache, dataset_hash);
 
         switch (alloc_choice) {
             case 'A':
@@ -180,6 +371,14 @@ private:
                 break;
             case 'E':
             case 'e':
+                runBinCacheSweep();
+                break;
+            case 'F':
+            case 'f':
+                runRackCompaction(memory_mgr);
+                break;
+            case 'G':
+            case 'g':
                 return;
             default:
                 ConsoleUI::printError("Invalid choice");
@@ -190,8 +389,39 @@ private:
         std::cin.get();
     }
 
+    void runRackCompaction(MemoryManager& memory_mgr) {
+        std::cout << "\nInitial allocation:\n1. First Fit\n2. Best Fit\n3. Next Fit\n4. Worst Fit\n";
+        const FitStrategy strategies[] = {FitStrategy::FIRST_FIT, FitStrategy::BEST_FIT, FitStrategy::NEXT_FIT,
+                                          FitStrategy::WORST_FIT};
+        memory_mgr.allocate(strategies[InputValidator::getChoice(1, 4) - 1]);
+        int percent = InputValidator::getPositiveInteger("Enter percent of placed orders that have shipped (max 100): ", 100);
+        int released = memory_mgr.releaseShipped(percent, data_gen.getSeed());
+        ConsoleUI::printInfo("Freed " + std::to_string(released) + " racks of shipped orders");
+
+        int max_moves = -1;
+        char budgeted = InputValidator::getYesNo("Limit the plan to a move budget");
+        if (budgeted == 'y' || budgeted == 'Y') max_moves = InputValidator::getPositiveInteger("Enter maximum moves: ");
+        memory_mgr.runCompactionPlanner(max_moves);
+    }
+
+    void runBinCacheSweep() {
+        int bins = InputValidator::getPositiveInteger("Enter number of bins in reserve storage (max 1000000): ", 1000000);
+        int accesses = InputValidator::getPositiveInteger("Enter pick accesses to simulate (max 50000000): ", 50000000);
+        std::vector<int> trace = BinAccessTrace::fromOrders(*dataset.processes, bins, accesses, data_gen.getSeed());
+        if (trace.empty()) {
+            ConsoleUI::printError("No orders to derive bin accesses from");
+            return;
+        }
+        std::vector<int> capacities;
+        for (int percent : {1, 2, 5, 10, 20, 50}) {
+            int capacity = std::max(1, (int)((long long)bins * percent / 100));
+            if (capacities.empty() || capacity > capacities.back()) capacities.push_back(capacity);
+        }
+        BinCacheSimulator(trace).runSweep(capacities);
+    }
+
     void runTruckMovementManagement() {
-        ConsoleUI::printHeader("TRUCK MOVEMENT MANAGEMENT");
+        ConsoleUI::printMenuHeader("TRUCK MOVEMENT MANAGEMENT");
         std::cout << "\nSelect disk scheduling algorithm:\n";
         std::cout << "A. First Come First Serve (FCFS)\n";
         std::cout << "B. Shortest Seek Time First (SSTF)\n";
@@ -203,7 +433,8 @@ private:
         std::cout << "Enter choice (A-E): ";
         std::cin >> disk_choice;
 
-        DiskScheduler disk_sched(disk_requests, head_position, max_disk_size);
+        DiskScheduler disk_sched(dataset.disk_requests, dataset.head_position, dataset.max_disk_size);
+        disk_sched.setResultCache(&result_cache, dataset_hash);
 
         switch (disk_choice) {
             case 'A':
@@ -237,10 +468,70 @@ private:
     void runStockReplenishment() {
         ConsoleUI::printHeader("STOCK REPLENISHMENT COORDINATION");
 
-        int num_threads = InputValidator::getPositiveInteger("Enter number of threads: ");
+        char coroutines = InputValidator::getYesNo("Run producers and consumers as coroutines on a small executor");
+        if (coroutines == 'y' || coroutines == 'Y') {
+            int actors = InputValidator::getPositiveInteger("Enter number of producer/consumer actors (max 2000000): ", 2000000);
+            int items = InputValidator::getPositiveInteger("Enter items per producer (max 1000): ", 1000);
+            int executor_threads = (int)std::max(1u, std::min(8u, std::thread::hardware_concurrency()));
+            Synchronization sync(dataset.buffer_size, std::max(1, actors / 2), std::max(1, actors - actors / 2));
+            sync.runCoroutineProducerConsumer(items, executor_threads);
+        } else {
+            int num_threads = InputValidator::getPositiveInteger("Enter number of threads: ");
+            int shards = InputValidator::getPositiveInteger("Enter number of zone buffer shards (1 = single shared buffer, max 256): ", 256);
+            Synchronization sync(dataset.buffer_size, num_threads, num_threads, shards);
+            sync.runProducerConsumer();
+        }
+
+        std::cout << "\nPress Enter to return to main menu...";
+        std::cin.ignore();
+        std::cin.get();
+    }
+
+    void runOrderPipeline() {
+        ConsoleUI::printHeader("END-TO-END ORDER PIPELINE");
+
+        PipelineConfig config;
+        std::cout << "\nPicking order:\n1. FCFS\n2. SJF\n3. Priority\n";
+        const CPUAlgorithm pick_algorithms[] = {CPUAlgorithm::FCFS, CPUAlgorithm::SJF, CPUAlgorithm::PRIORITY_NON_PREEMPTIVE};
+        config.pick_algorithm = pick_algorithms[InputValidator::getChoice(1, 3) - 1];
+        config.num_pickers = InputValidator::getPositiveInteger("Enter number of pickers (max 256): ", 256);
+
+        std::cout << "Rack slot strategy:\n1. First Fit\n2. Best Fit\n3. Next Fit\n4. Worst Fit\n";
+        config.rack_strategy = static_cast<FitStrategy>(InputValidator::getChoice(1, 4) - 1);
+        config.staging_capacity = InputValidator::getPositiveInteger("Enter staging capacity (picked orders awaiting a rack): ");
+
+        std::cout << "Truck dispatch order:\n1. FCFS\n2. SSTF\n3. SCAN\n4. C-SCAN\n";
+        config.truck_algorithm = static_cast<DiskAlgorithm>(InputValidator::getChoice(1, 4) - 1);
+        config.num_trucks = InputValidator::getPositiveInteger("Enter number of trucks (max 256): ", 256);
+        config.cylinders_per_unit = InputValidator::getPositiveInteger("Enter truck speed (dock positions per time unit): ");
+        config.load_time = InputValidator::getPositiveInteger("Enter truck load time per order: ");
+
+        config.restock_interval = InputValidator::getPositiveInteger("Enter stock refill interval (time units): ");
+        config.restock_batch = InputValidator::getPositiveInteger("Enter stock units per refill: ");
+
+        OrderPipeline pipeline(dataset, config);
+        pipeline.runAndReport();
 
-        Synchronization sync(buffer_size, num_threads, num_threads);
-        sync.runProducerConsumer();
+        std::cout << "\nPress Enter to return to main menu...";
+        std::cin.ignore();
+        std::cin.get();
+    }
+
+    void runReplicationStudy() {
+        ConsoleUI::printHeader("MONTE CARLO REPLICATION STUDY");
+        ConsoleUI::printInfo("Each replication regenerates the dataset with the current parameters and a derived seed");
+
+        ReplicationConfig config;
+        config.generator = data_gen.getConfig();
+        config.replications = InputValidator::getPositiveInteger("Enter number of replications (max 100000): ", 100000);
+        config.base_seed = (unsigned)InputValidator::getPositiveInteger("Enter base seed: ");
+        int cores = (int)std::max(1u, std::thread::hardware_concurrency());
+        config.num_threads = InputValidator::getPositiveInteger("Enter worker threads (" + std::to_string(cores) + " cores, max 256): ", 256);
+        config.time_quantum = InputValidator::getPositiveInteger("Enter time quantum for Round Robin: ", 1000);
+        config.context_switch_cost = context_switch_cost;
+
+        ReplicationStudy study(config);
+        study.runAndReport();
 
         std::cout << "\nPress Enter to return to main menu...";
         std::cin.ignore();
@@ -249,9 +540,18 @@ private:
 
     void exitSimulation() {
         ConsoleUI::printHeader("EXITING WAREHOUSE SIMULATOR");
+#ifdef WAREHOUSE_PROFILE
+        Profiler::instance().displayReport();
+        Profiler::instance().saveChromeTrace("warehouse_profile.json");
+#endif
+        FileManager::flushWrites();
         ConsoleUI::printInfo("Cleaning up generated data...");
         FileManager::clearDirectory("data");
         FileManager::clearDirectory("output");
+        if (result_cache.isEnabled() && result_cache.getHits() + result_cache.getMisses() > 0) {
+            ConsoleUI::printInfo("Result cache kept in " + result_cache.getDirectory() + "/ (" + std::to_string(result_cache.getHits())
+                                 + " hits, " + std::to_string(result_cache.getMisses()) + " misses this session)");
+        }
         ConsoleUI::printSuccess("All data cleared. Goodbye!");
     }
 };
@@ -0,0 +1,292 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include "utilities.h"
+#include "cpu_scheduler.h"
+#include <thread>
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <memory>
+#include <random>
+#include <chrono>
+#include <condition_variable>
+
+struct WorkerStats {
+    int worker_id;
+    int tasks_executed;
+    int steals;
+    int failed_steals;
+    double busy_us;
+};
+
+class WorkStealingPool {
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct WorkerDeque {
+        std::deque<int> tasks;
+        std::mutex mtx;
+    };
+
+    int num_workers;
+    int unit_us;
+    double spins_per_us;
+    std::vector<std::unique_ptr<WorkerDeque>> deques;
+    std::vector<WorkerStats> stats;
+    std::vector<Process> executed;
+    std::vector<int> executed_by;
+    std::vector<double> start_us;
+    std::vector<double> end_us;
+    std::atomic<int> pending;
+    std::atomic<int> queued;
+    std::mutex idle_mtx;
+    std::condition_variable work_ready;
+    double makespan_us;
+
+public:
+    WorkStealingPool(int workers, int time_unit_us)
+        : num_workers(workers), unit_us(time_unit_us), spins_per_us(0), pending(0), queued(0), makespan_us(0) {
+        for (int i = 0; i < num_workers; ++i) {
+            deques.push_back(std::make_unique<WorkerDeque>());
+        }
+    }
+
+    void calibrate() {
+        const long long probe_iterations = 5000000;
+        auto start = Clock::now();
+        spin(probe_iterations);
+        double elapsed = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        spins_per_us = probe_iterations / std::max(elapsed, 1.0);
+
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "Calibrated spin rate: " << spins_per_us << " iterations/us ("
+                  << unit_us << " us of work per time unit)\n";
+    }
+
+    void execute(const std::vector<Process>& procs) {
+        ConsoleUI::printSection("Parallel Execution - " + std::to_string(num_workers) + " Workers with Work Stealing");
+        if (spins_per_us == 0) calibrate();
+
+        executed = procs;
+        std::stable_sort(executed.begin(), executed.end(),
+                        [](const Process& a, const Process& b) { return a.arrival_time < b.arrival_time; });
+        executed_by.assign(executed.size(), 0);
+        start_us.assign(executed.size(), 0);
+        end_us.assign(executed.size(), 0);
+        stats.assign(num_workers, WorkerStats{0, 0, 0, 0, 0});
+        pending = (int)executed.size();
+        queued = 0;
+
+        Clock::time_point t0 = Clock::now();
+        std::vector<std::thread> workers;
+        for (int w = 0; w < num_workers; ++w) {
+            workers.push_back(std::thread([this, w, t0]() { workerLoop(w, t0); }));
+        }
+
+        for (size_t i = 0; i < executed.size(); ++i) {
+            std::this_thread::sleep_until(t0 + std::chrono::microseconds((long long)executed[i].arrival_time * unit_us));
+            WorkerDeque& target = *deques[i % num_workers];
+            {
+                std::lock_guard<std::mutex> lock(target.mtx);
+                target.tasks.push_back((int)i);
+            }
+            queued.fetch_add(1);
+            std::lock_guard<std::mutex> lock(idle_mtx);
+            work_ready.notify_one();
+        }
+
+        for (auto& worker : workers) {
+            if (worker.joinable()) worker.join();
+        }
+
+        makespan_us = 0;
+        for (size_t i = 0; i < executed.size(); ++i) {
+            makespan_us = std::max(makespan_us, end_us[i]);
+            executed[i].completion_time = (int)std::lround(end_us[i] / unit_us);
+            executed[i].waiting_time = std::max(0, (int)std::lround(start_us[i] / unit_us) - executed[i].arrival_time);
+            executed[i].turnaround_time = executed[i].completion_time - executed[i].arrival_time;
+        }
+
+        displayResults();
+        saveToCSV("output/parallel_execution_results.csv");
+    }
+
+    void compareWithSimulation(std::shared_ptr<const std::vector<Process>> procs, int time_quantum) {
+        CPUScheduler scheduler(procs);
+        std::vector<std::string> models;
+        std::vector<int> makespans;
+        std::vector<double> waits;
+
+        const std::pair<CPUAlgorithm, std::string> simulated[] = {
+            {CPUAlgorithm::FCFS, "FCFS"}, {CPUAlgorithm::SJF, "SJF"}, {CPUAlgorithm::ROUND_ROBIN, "RR"}};
+        for (const auto& model : simulated) {
+            scheduler.schedule(model.first, time_quantum);
+            models.push_back("Simulated " + model.second + " (1 worker)");
+            makespans.push_back(scheduler.getTotalTime());
+            waits.push_back(averageWaiting(scheduler.getCompleted()));
+        }
+
+        long long total_burst = 0;
+        int min_arrival = INT_MAX;
+        int critical_path = 0;
+        for (const auto& p : *procs) {
+            total_burst += p.burst_time;
+            min_arrival = std::min(min_arrival, p.arrival_time);
+            critical_path = std::max(critical_path, p.arrival_time + p.burst_time);
+        }
+        int ideal_bound = procs->empty() ? 0 :
+            std::max(critical_path, min_arrival + (int)((total_burst + num_workers - 1) / num_workers));
+
+        ConsoleUI::printSection("MODEL VS MEASURED - " + std::to_string(num_workers) + " Workers");
+        std::cout << std::left << std::setw(32) << "Model" << std::setw(16) << "Makespan" << std::setw(16) << "Avg Waiting" << "\n";
+        std::cout << std::string(64, '-') << "\n";
+        std::cout << std::fixed << std::setprecision(2);
+        for (size_t i = 0; i < models.size(); ++i) {
+            std::cout << std::left << std::setw(32) << models[i] << std::setw(16) << makespans[i] << std::setw(16) << waits[i] << "\n";
+        }
+        std::cout << std::left << std::setw(32) << "Ideal bound (" + std::to_string(num_workers) + " workers)"
+                  << std::setw(16) << ideal_bound << std::setw(16) << "-" << "\n";
+        std::cout << std::left << std::setw(32) << "Measured work stealing"
+                  << std::setw(16) << makespan_us / unit_us << std::setw(16) << averageWaiting(executed) << "\n";
+    }
+
+private:
+    static void spin(long long iterations) {
+        volatile unsigned long long sink = 0;
+        for (long long i = 0; i < iterations; ++i) {
+            sink = sink + ((unsigned long long)i ^ (sink >> 3));
+        }
+    }
+
+    static double averageWaiting(const std::vector<Process>& procs) {
+        if (procs.empty()) return 0;
+        double total = 0;
+        for (const auto& p : procs) total += p.waiting_time;
+        return total / procs.size();
+    }
+
+    int popLocal(int worker_id) {
+        WorkerDeque& own = *deques[worker_id];
+        std::lock_guard<std::mutex> lock(own.mtx);
+        if (own.tasks.empty()) return -1;
+        int task = own.tasks.front();
+        own.tasks.pop_front();
+        queued.fetch_sub(1);
+        return task;
+    }
+
+    int stealFrom(int victim_id) {
+        WorkerDeque& victim = *deques[victim_id];
+        std::unique_lock<std::mutex> lock(victim.mtx, std::try_to_lock);
+        if (!lock.owns_lock() || victim.tasks.empty()) return -1;
+        int task = victim.tasks.back();
+        victim.tasks.pop_back();
+        queued.fetch_sub(1);
+        return task;
+    }
+
+    void workerLoop(int worker_id, Clock::time_point t0) {
+        std::mt19937 gen(worker_id * 7919 + 1);
+        std::uniform_int_distribution<> victim_dist(0, num_workers - 1);
+        WorkerStats& ws = stats[worker_id];
+        ws.worker_id = worker_id + 1;
+
+        while (pending.load() > 0) {
+            int task = popLocal(worker_id);
+            if (task == -1 && num_workers > 1) {
+                int victim = victim_dist(gen);
+                if (victim == worker_id) victim = (victim + 1) % num_workers;
+                task = stealFrom(victim);
+                if (task != -1) {
+                    ws.steals++;
+                } else {
+                    ws.failed_steals++;
+                }
+            }
+            if (task == -1) {
+                std::unique_lock<std::mutex> lock(idle_mtx);
+                work_ready.wait(lock, [this]() { return queued.load() > 0 || pending.load() == 0; });
+                continue;
+            }
+
+            auto start = Clock::now();
+            spin((long long)(executed[task].burst_time * (double)unit_us * spins_per_us));
+            auto end = Clock::now();
+
+            start_us[task] = std::chrono::duration<double, std::micro>(start - t0).count();
+            end_us[task] = std::chrono::duration<double, std::micro>(end - t0).count();
+            executed_by[task] = worker_id + 1;
+            ws.busy_us += end_us[task] - start_us[task];
+            ws.tasks_executed++;
+            if (pending.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(idle_mtx);
+                work_ready.notify_all();
+            }
+        }
+    }
+
+    void displayResults() {
+        double makespan_units = makespan_us / unit_us;
+        int total_steals = 0;
+        if (!ConsoleUI::showSummary()) return;
+
+        ConsoleUI::printSection("PARALLEL EXECUTION RESULTS - Work Stealing");
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "Measured Makespan: " << makespan_units << " units (" << makespan_us / 1000.0 << " ms)\n";
+        std::cout << "Avg Waiting Time: " << averageWaiting(executed) << " units\n";
+        std::cout << "Throughput: " << (makespan_units > 0 ? executed.size() / makespan_units : 0) << " orders/unit\n\n";
+
+        std::ostringstream table;
+        table << std::fixed << std::setprecision(2);
+        table << std::left << std::setw(10) << "Worker" << std::setw(10) << "Orders" << std::setw(10) << "Steals"
+              << std::setw(14) << "Failed_Steals" << std::setw(12) << "Busy_ms" << std::setw(12) << "Utilization" << "\n";
+        table << std::string(68, '-') << "\n";
+        for (const auto& ws : stats) {
+            double utilization = makespan_us > 0 ? ws.busy_us * 100.0 / makespan_us : 0;
+            table << std::left << std::setw(10) << "W" + std::to_string(ws.worker_id)
+                  << std::setw(10) << ws.tasks_executed << std::setw(10) << ws.steals
+                  << std::setw(14) << ws.failed_steals << std::setw(12) << ws.busy_us / 1000.0
+                  << utilization << "%\n";
+            total_steals += ws.steals;
+        }
+        if (ConsoleUI::showItems()) std::cout << table.str();
+        std::cout << "\nTotal Steals: " << total_steals << "\n";
+    }
+
+    void saveToCSV(const std::string& filename) {
+        std::vector<std::vector<std::string>> csv_data;
+        csv_data.push_back({"Order_ID", "Arrival_Time", "Burst_Time", "Worker", "Start_us", "End_us", "Completion_Time", "Waiting_Time"});
+
+        for (size_t i = 0; i < executed.size(); ++i) {
+            csv_data.push_back({
+                std::to_string(executed[i].id),
+                std::to_string(executed[i].arrival_time),
+                std::to_string(executed[i].burst_time),
+                "W" + std::to_string(executed_by[i]),
+                std::to_string(start_us[i]),
+                std::to_string(end_us[i]),
+                std::to_string(executed[i].completion_time),
+                std::to_string(executed[i].waiting_time)
+            });
+        }
+
+        csv_data.push_back({""});
+        csv_data.push_back({"Worker", "Orders", "Steals", "Failed_Steals", "Busy_us", "Utilization"});
+        for (const auto& ws : stats) {
+            csv_data.push_back({
+                "W" + std::to_string(ws.worker_id),
+                std::to_string(ws.tasks_executed),
+                std::to_string(ws.steals),
+                std::to_string(ws.failed_steals),
+                std::to_string(ws.busy_us),
+                std::to_string(makespan_us > 0 ? ws.busy_us * 100.0 / makespan_us : 0)
+            });
+        }
+        csv_data.push_back({"Makespan_us", std::to_string(makespan_us)});
+
+        FileManager::writeToCSV(filename, csv_data);
+    }
+};
+
+#endif